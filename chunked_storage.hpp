@@ -0,0 +1,431 @@
+#ifndef CHUNKED_STORAGE_H
+#define CHUNKED_STORAGE_H
+
+#include "utilities.hpp"
+
+namespace ft {
+
+// One block of a chunked_storage, [begin;end) holds the objects
+template <class T>
+struct storage_chunk {
+  T* begin;
+  T* end;
+  storage_chunk* prev;
+  storage_chunk* next;
+};
+
+//**************************************************
+// This is a forward iterator
+//
+// Every chunk but the last one is full, so the iterator only changes chunks
+// when it reaches the end of one that has a successor
+//**************************************************
+template <class datatype, class chunk_type>
+class iterator_chunked {
+ public:
+  typedef std::forward_iterator_tag iterator_category;
+  typedef datatype value_type;
+  typedef datatype* pointer;
+  typedef datatype& reference;
+  typedef std::ptrdiff_t difference_type;
+
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  iterator_chunked() : cur_(NULL), chunk_(NULL) {}
+  iterator_chunked(pointer cur, chunk_type* chunk) : cur_(cur), chunk_(chunk) {}
+  iterator_chunked(const iterator_chunked& other)
+      : cur_(other.cur_), chunk_(other.chunk_) {}
+  ~iterator_chunked() {}
+
+  //**************************************************
+  // Operator overloads
+  //**************************************************
+
+  iterator_chunked& operator=(const iterator_chunked& other) {
+    cur_ = other.cur_;
+    chunk_ = other.chunk_;
+    return *this;
+  }
+
+  reference operator*() const { return *cur_; }
+  pointer operator->() const { return cur_; }
+
+  iterator_chunked& operator++() {
+    ++cur_;
+    if (cur_ == chunk_->end && chunk_->next) {
+      chunk_ = chunk_->next;
+      cur_ = chunk_->begin;
+    }
+    return *this;
+  }
+  iterator_chunked operator++(int) {
+    iterator_chunked tmp(*this);
+    ++*this;
+    return tmp;
+  }
+
+  bool operator==(const iterator_chunked& other) const {
+    return cur_ == other.cur_;
+  }
+  bool operator!=(const iterator_chunked& other) const {
+    return cur_ != other.cur_;
+  }
+
+  //**************************************************
+  // Functions
+  //**************************************************
+
+  pointer base() const { return cur_; }
+
+  //**************************************************
+  // Conversion overloads
+  //**************************************************
+
+  // Implicit conversion to const_iterator
+  operator iterator_chunked<const value_type, chunk_type>() const {
+    return iterator_chunked<const value_type, chunk_type>(cur_, chunk_);
+  }
+
+ protected:
+  pointer cur_;
+  chunk_type* chunk_;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::chunked_storage
+//
+// Container for ft::stack that never moves its objects:
+//   ft::stack<T, ft::chunked_storage<T> >
+// The objects live in a list of chunks, each twice as big as the one before
+// (up to 16 MB). Growing allocates a new chunk instead of copying the stack
+// into a bigger buffer. The last chunk that ran empty is kept as a spare, so a
+// stack going up and down around a chunk boundary doesn't allocate.
+//
+// Only the members ft::stack needs are offered, plus forward iteration and
+// the comparisons.
+//////////////////////////////////////////////////////////////////////////////
+
+template <class T, class Allocator = std::allocator<T> >
+class chunked_storage {
+ public:
+  //**************************************************
+  // Typedefs
+  //**************************************************
+
+  typedef T value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Allocator allocator_type;
+
+  typedef typename Allocator::pointer pointer;
+  typedef typename Allocator::const_pointer const_pointer;
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef iterator_chunked<value_type, storage_chunk<T> > iterator;
+  typedef iterator_chunked<const value_type, storage_chunk<T> > const_iterator;
+
+ private:
+  typedef storage_chunk<T> chunk;
+  typedef typename Allocator::template rebind<chunk>::other chunk_allocator;
+
+ public:
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  chunked_storage()
+      : allocator_(allocator_type()),
+        top_(NULL),
+        top_ptr_(NULL),
+        top_begin_(NULL),
+        top_end_(NULL),
+        spare_(NULL),
+        size_(0) {}
+
+  explicit chunked_storage(const allocator_type& alloc)
+      : allocator_(alloc),
+        top_(NULL),
+        top_ptr_(NULL),
+        top_begin_(NULL),
+        top_end_(NULL),
+        spare_(NULL),
+        size_(0) {}
+
+  /**
+   * @brief Copy constructor. All objects go into a single chunk
+   *
+   * @param other
+   */
+  chunked_storage(const chunked_storage& other)
+      : allocator_(other.allocator_),
+        top_(NULL),
+        top_ptr_(NULL),
+        top_begin_(NULL),
+        top_end_(NULL),
+        spare_(NULL),
+        size_(0) {
+    if (other.empty()) return;
+    add_chunk(std::max(other.size(), first_chunk_size()));
+    try {
+      for (const_iterator it = other.begin(); it != other.end(); ++it)
+        push_back(*it);
+    } catch (...) {
+      deallocate_all();
+      throw;
+    }
+  }
+
+  ~chunked_storage() { deallocate_all(); }
+
+  //**************************************************
+  // Operator overloads
+  //**************************************************
+
+  chunked_storage& operator=(const chunked_storage& other) {
+    if (this != &other) {
+      chunked_storage tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  //**************************************************
+  // Member functions
+  //**************************************************
+
+  allocator_type get_allocator() const { return allocator_; }
+
+  reference back() { return top_ptr_[-1]; }
+  const_reference back() const { return top_ptr_[-1]; }
+
+  iterator begin() {
+    chunk* bottom = bottom_chunk();
+    return bottom ? iterator(bottom->begin, bottom) : iterator();
+  }
+  const_iterator begin() const {
+    chunk* bottom = bottom_chunk();
+    return bottom ? const_iterator(bottom->begin, bottom) : const_iterator();
+  }
+  iterator end() { return iterator(top_ptr_, top_); }
+  const_iterator end() const { return const_iterator(top_ptr_, top_); }
+
+  bool empty() const { return size_ == 0; }
+
+  size_type size() const { return size_; }
+
+  size_type max_size() const { return allocator_.max_size(); }
+
+  /**
+   * @brief Adds an object on top. Takes a new chunk when the top one is full
+   *
+   * @param value
+   */
+  void push_back(const value_type& value) {
+    if (top_ptr_ == top_end_) {
+      grow();
+      try {
+        construct(top_ptr_, value);
+      } catch (...) {
+        shrink();
+        throw;
+      }
+    } else {
+      construct(top_ptr_, value);
+    }
+    ++top_ptr_;
+    ++size_;
+  }
+
+  /**
+   * @brief Removes the top object. A chunk that runs empty becomes the spare
+   *
+   */
+  void pop_back() {
+    if (empty()) return;
+    --top_ptr_;
+    if (!ft::is_integral<value_type>::value) allocator_.destroy(top_ptr_);
+    --size_;
+    if (top_ptr_ == top_begin_ && top_->prev) shrink();
+  }
+
+  /**
+   * @brief Destroys all objects and gives back all chunks but the first
+   *
+   */
+  void clear() {
+    while (!empty()) pop_back();
+    release_spare();
+  }
+
+  void swap(chunked_storage& other) {
+    std::swap(allocator_, other.allocator_);
+    std::swap(top_, other.top_);
+    std::swap(top_ptr_, other.top_ptr_);
+    std::swap(top_begin_, other.top_begin_);
+    std::swap(top_end_, other.top_end_);
+    std::swap(spare_, other.spare_);
+    std::swap(size_, other.size_);
+  }
+
+ private:
+  //**************************************************
+  // Member objects
+  //**************************************************
+
+  allocator_type allocator_;
+  chunk* top_;        // the chunk holding the top object
+  pointer top_ptr_;   // behind the top object
+  pointer top_begin_;  // top_->begin and top_->end, NULL without chunks
+  pointer top_end_;
+  chunk* spare_;      // an empty chunk, not linked to the others
+  size_type size_;
+
+  //**************************************************
+  // Private member functions
+  //**************************************************
+
+  static size_type first_chunk_size() {
+    return std::max<size_type>(16, 1024 / sizeof(T));
+  }
+
+  static size_type max_chunk_size() {
+    return std::max<size_type>(16, (1 << 24) / sizeof(T));
+  }
+
+  chunk* bottom_chunk() const {
+    chunk* bottom = top_;
+    while (bottom && bottom->prev) bottom = bottom->prev;
+    return bottom;
+  }
+
+  // Puts a chunk on top, the spare if there is one
+  void grow() {
+    if (spare_) {
+      chunk* spare = spare_;
+      spare_ = NULL;
+      spare->prev = top_;
+      if (top_) top_->next = spare;
+      set_top(spare);
+      return;
+    }
+    size_type capacity = first_chunk_size();
+    if (top_)
+      capacity = std::min(2 * static_cast<size_type>(top_->end - top_->begin),
+                          max_chunk_size());
+    add_chunk(capacity);
+  }
+
+  void add_chunk(size_type capacity) {
+    chunk_allocator chunk_alloc(allocator_);
+    chunk* new_chunk = chunk_alloc.allocate(1);
+    try {
+      new_chunk->begin = allocator_.allocate(capacity);
+    } catch (...) {
+      chunk_alloc.deallocate(new_chunk, 1);
+      throw;
+    }
+    new_chunk->end = new_chunk->begin + capacity;
+    new_chunk->prev = top_;
+    new_chunk->next = NULL;
+    if (top_) top_->next = new_chunk;
+    set_top(new_chunk);
+  }
+
+  // Turns the empty top chunk into the spare, the older spare is freed
+  void shrink() {
+    chunk* empty = top_;
+    set_top(top_->prev);
+    if (top_) {
+      top_->next = NULL;
+      top_ptr_ = top_end_;
+    }
+    release_spare();
+    spare_ = empty;
+  }
+
+  // Makes top the top chunk, top_ptr_ points to its start
+  void set_top(chunk* top) {
+    top_ = top;
+    top_begin_ = top ? top->begin : NULL;
+    top_end_ = top ? top->end : NULL;
+    top_ptr_ = top_begin_;
+  }
+
+  template <class U>  // U = value_type
+  void construct(
+      U* position,
+      const typename ft::enable_if<ft::is_integral<U>::value, U>::type& value) {
+    *position = value;
+  }
+
+  template <class U>  // U = value_type
+  void construct(U* position,
+                 const typename ft::enable_if<!ft::is_integral<U>::value,
+                                              U>::type& value) {
+    allocator_.construct(position, value);
+  }
+
+  void release_spare() {
+    if (!spare_) return;
+    allocator_.deallocate(spare_->begin, spare_->end - spare_->begin);
+    chunk_allocator(allocator_).deallocate(spare_, 1);
+    spare_ = NULL;
+  }
+
+  void deallocate_all() {
+    clear();
+    if (top_) {
+      spare_ = top_;
+      release_spare();
+    }
+    set_top(NULL);
+  }
+};
+
+//**************************************************
+// Non-member operator overloads
+//**************************************************
+
+template <class T, class Alloc>
+bool operator==(const chunked_storage<T, Alloc>& lhs,
+                const chunked_storage<T, Alloc>& rhs) {
+  if (lhs.size() != rhs.size()) return false;
+  return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class T, class Alloc>
+bool operator!=(const chunked_storage<T, Alloc>& lhs,
+                const chunked_storage<T, Alloc>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <class T, class Alloc>
+bool operator<(const chunked_storage<T, Alloc>& lhs,
+               const chunked_storage<T, Alloc>& rhs) {
+  return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                     rhs.end());
+}
+
+template <class T, class Alloc>
+bool operator>(const chunked_storage<T, Alloc>& lhs,
+               const chunked_storage<T, Alloc>& rhs) {
+  return rhs < lhs;
+}
+
+template <class T, class Alloc>
+bool operator<=(const chunked_storage<T, Alloc>& lhs,
+                const chunked_storage<T, Alloc>& rhs) {
+  return !(rhs < lhs);
+}
+
+template <class T, class Alloc>
+bool operator>=(const chunked_storage<T, Alloc>& lhs,
+                const chunked_storage<T, Alloc>& rhs) {
+  return !(lhs < rhs);
+}
+
+}  // namespace ft
+
+#endif  // CHUNKED_STORAGE_H
@@ -0,0 +1,738 @@
+#ifndef DEQUE_H
+#define DEQUE_H
+#include "iterator_deque.hpp"
+#include "utilities.hpp"
+
+namespace ft {
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::deque
+//
+// The objects live in fixed-size blocks (see deque_block_size). A map, an
+// array of block pointers, keeps the blocks in order, with the used entries
+// in its middle so it can grow both ways. Pushing at either end only ever
+// allocates a new block and maybe a bigger map: objects never move once they
+// are built, so references to them stay valid.
+//
+// Invariants once the map exists: the blocks of [start_.node_;finish_.node_]
+// are allocated and finish_.cur_ always points into the last of them, so a
+// full last block is followed by an empty one.
+//////////////////////////////////////////////////////////////////////////////
+
+template <typename T, typename Allocator = std::allocator<T> >
+class deque {
+ public:
+  typedef T value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Allocator allocator_type;
+
+  typedef typename Allocator::pointer pointer;
+  typedef typename Allocator::const_pointer const_pointer;
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef Iterator_deque<value_type, pointer> iterator;
+  typedef Iterator_deque<const value_type, pointer> const_iterator;
+  typedef ft::reverse_iterator<iterator> reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+
+ private:
+  typedef typename Allocator::template rebind<pointer>::other map_allocator;
+
+ public:
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  /**
+   * @brief Construct a new deque object. Nothing is allocated until the first
+   * object is added
+   *
+   */
+  deque() : allocator_(allocator_type()), map_(NULL), map_size_(0) {}
+
+  /**
+   * @brief Construct a new deque object explicitly with a certain allocator
+   *
+   * @param alloc an allocator
+   */
+  explicit deque(const allocator_type& alloc)
+      : allocator_(alloc), map_(NULL), map_size_(0) {}
+
+  /**
+   * @brief Construct a new deque object
+   *
+   * @param count size of the deque
+   * @param value the value to fill the deque with
+   * @param alloc an allocator (optional. Standard: std::allocator<T>)
+   */
+  explicit deque(size_type count, const value_type& value = value_type(),
+                 const allocator_type& alloc = allocator_type())
+      : allocator_(alloc), map_(NULL), map_size_(0) {
+    try {
+      insert(end(), count, value);
+    } catch (...) {
+      deallocate_all();
+      throw;
+    }
+  }
+
+  /**
+   * @brief Construct a new deque object with a range [first;last)
+   *
+   * @tparam InputIt
+   * @param first Iterator pointing to the start of the range
+   * @param last Iterator pointing to the end of the range (excluded)
+   * @param alloc an allocator (optional. Standard: std::allocator<T>)
+   */
+  template <class InputIt>
+  deque(InputIt first, InputIt last,
+        const allocator_type& alloc = allocator_type(),
+        typename ft::enable_if<!std::numeric_limits<InputIt>::is_integer,
+                               InputIt>::type* = 0)
+      : allocator_(alloc), map_(NULL), map_size_(0) {
+    try {
+      for (; first != last; ++first) push_back(*first);
+    } catch (...) {
+      deallocate_all();
+      throw;
+    }
+  }
+
+  /**
+   * @brief Copy constructor
+   *
+   * @param other deque to copy
+   */
+  deque(const deque& other)
+      : allocator_(other.allocator_), map_(NULL), map_size_(0) {
+    try {
+      for (const_iterator it = other.begin(); it != other.end(); ++it)
+        push_back(*it);
+    } catch (...) {
+      deallocate_all();
+      throw;
+    }
+  }
+
+#if __cplusplus >= 201103L
+  /**
+   * @brief Move constructor, takes over the blocks of other
+   *
+   * @param other deque to move from, empty afterwards
+   */
+  deque(deque&& other) noexcept
+      : allocator_(ft::move(other.allocator_)),
+        map_(other.map_),
+        map_size_(other.map_size_),
+        start_(other.start_),
+        finish_(other.finish_) {
+    other.map_ = NULL;
+    other.map_size_ = 0;
+    other.start_ = iterator();
+    other.finish_ = iterator();
+  }
+#endif
+
+  /**
+   * @brief Destroy the deque object
+   *
+   */
+  ~deque() { deallocate_all(); }
+
+  //**************************************************
+  // Operator overloads
+  //**************************************************
+
+  /**
+   * @brief assignment operator overload
+   *
+   * @param other source
+   * @return deque& *this after assigning
+   */
+  deque& operator=(const deque& other) {
+    if (this != &other) assign(other.begin(), other.end());
+    return *this;
+  }
+
+#if __cplusplus >= 201103L
+  /**
+   * @brief move assignment operator overload
+   *
+   * @param other source, empty afterwards
+   * @return deque& *this after assigning
+   */
+  deque& operator=(deque&& other) {
+    deque tmp(ft::move(other));
+    swap(tmp);
+    return *this;
+  }
+#endif
+
+  //**************************************************
+  // Member functions
+  //**************************************************
+
+  /**
+   * @brief rebuilds the deque with the size "count", filled with value "value"
+   *
+   * @param count
+   * @param value
+   */
+  void assign(size_type count, const T& value) {
+    size_type size = this->size();
+    iterator it = begin();
+    for (size_type i = 0; i < count && i < size; ++i, ++it) *it = value;
+    if (count < size)
+      erase(it, end());
+    else
+      insert(end(), count - size, value);
+  }
+
+  /**
+   * @brief rebuilds the deque with the range [first;last). The objects
+   * already there are assigned to
+   *
+   * @tparam InputIt
+   * @param first Iterator pointing to the start of the range
+   * @param last Iterator pointing to the end of the range
+   */
+  template <class InputIt>
+  void assign(InputIt first, InputIt last,
+              typename ft::enable_if<!std::numeric_limits<InputIt>::is_integer,
+                                     InputIt>::type* = 0) {
+    iterator it = begin();
+    for (; first != last && it != end(); ++first, ++it) *it = *first;
+    if (first == last)
+      erase(it, end());
+    else
+      insert(end(), first, last);
+  }
+
+  allocator_type get_allocator() const { return allocator_; }
+
+  // Element access
+
+  reference at(size_type pos) {
+    if (pos >= size()) throw std::out_of_range("deque::at out of range");
+    return (*this)[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size()) throw std::out_of_range("deque::at out of range");
+    return (*this)[pos];
+  }
+
+  reference operator[](size_type pos) {
+    size_type offset = pos + (start_.cur_ - start_.first_);
+    return start_.node_[offset / block_size()][offset % block_size()];
+  }
+
+  const_reference operator[](size_type pos) const {
+    size_type offset = pos + (start_.cur_ - start_.first_);
+    return start_.node_[offset / block_size()][offset % block_size()];
+  }
+
+  reference front() { return *start_; }
+  const_reference front() const { return *start_; }
+
+  reference back() { return *(finish_ - 1); }
+  const_reference back() const { return *(finish_ - 1); }
+
+  // Iterators
+
+  iterator begin() { return start_; }
+  const_iterator begin() const { return start_; }
+  iterator end() { return finish_; }
+  const_iterator end() const { return finish_; }
+  reverse_iterator rbegin() { return reverse_iterator(finish_); }
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(finish_);
+  }
+  reverse_iterator rend() { return reverse_iterator(start_); }
+  const_reverse_iterator rend() const { return const_reverse_iterator(start_); }
+
+  // Capacity functions
+
+  bool empty() const { return start_ == finish_; }
+
+  size_type size() const { return finish_ - start_; }
+
+  size_type max_size() const { return allocator_.max_size(); }
+
+  /**
+   * @brief destroys all stored objects and gives back all blocks but one
+   *
+   */
+  void clear() {
+    if (!map_) return;
+    destroy(start_, finish_);
+    for (pointer* node = start_.node_ + 1; node <= finish_.node_; ++node)
+      deallocate_block(node);
+    finish_ = start_;
+  }
+
+  /**
+   * @brief Inserts one element into the deque. The objects on the shorter
+   * side of pos are shifted
+   *
+   * @param pos An Iterator pointing to the insert position
+   * @param value
+   * @return iterator An iterator to the position of the new insert
+   */
+  iterator insert(const const_iterator& pos, const value_type& value) {
+    size_type index = pos - const_iterator(start_);
+    if (index < size() / 2) {
+      push_front(value);
+      std::rotate(begin(), begin() + 1, begin() + index + 1);
+    } else {
+      push_back(value);
+      std::rotate(begin() + index, end() - 1, end());
+    }
+    return begin() + index;
+  }
+
+  /**
+   * @brief Inserts count copies of value into the deque
+   *
+   * @param pos An Iterator pointing to the insert position
+   * @param count
+   * @param value
+   * @return iterator An iterator to the first new object
+   */
+  iterator insert(const const_iterator& pos, size_type count,
+                  const value_type& value) {
+    size_type index = pos - const_iterator(start_);
+    size_type size = this->size();
+    size_type i = 0;
+    // The copies are built at the shorter end, then rotated into place. If
+    // one throws, the new objects are removed again
+    try {
+      if (index < size / 2) {
+        for (; i < count; ++i) push_front(value);
+        std::rotate(begin(), begin() + count, begin() + count + index);
+      } else {
+        for (; i < count; ++i) push_back(value);
+        std::rotate(begin() + index, begin() + size, end());
+      }
+    } catch (...) {
+      if (index < size / 2)
+        erase(begin(), begin() + i);
+      else
+        erase(begin() + size, end());
+      throw;
+    }
+    return begin() + index;
+  }
+
+  /**
+   * @brief Inserts a range [first;last) elements into the deque
+   *
+   * @tparam InputIt
+   * @param pos An Iterator pointing to the insert position
+   * @param first An Iterator pointing to the start of the range to be inserted
+   * @param last An Iterator pointing to the end of the range to be inserted
+   * @return iterator An iterator to the first new object
+   */
+  template <class InputIt>
+  iterator insert(
+      const const_iterator& pos, InputIt first, InputIt last,
+      typename ft::enable_if<!std::numeric_limits<InputIt>::is_integer,
+                             InputIt>::type* = 0) {
+    size_type index = pos - const_iterator(start_);
+    size_type size = this->size();
+    bool front = index < size / 2;
+    size_type count = 0;
+    // Pushed at the front, the range ends up reversed and is turned around
+    try {
+      for (; first != last; ++first, ++count) {
+        if (front)
+          push_front(*first);
+        else
+          push_back(*first);
+      }
+    } catch (...) {
+      if (front)
+        erase(begin(), begin() + count);
+      else
+        erase(begin() + size, end());
+      throw;
+    }
+    if (front) {
+      std::reverse(begin(), begin() + count);
+      std::rotate(begin(), begin() + count, begin() + count + index);
+    } else {
+      std::rotate(begin() + index, begin() + size, end());
+    }
+    return begin() + index;
+  }
+
+  /**
+   * @brief Erases one object from the deque
+   *
+   * @param pos An iterator pointing to the object to be erased
+   * @return iterator An iterator pointing to the object following the erased
+   * object
+   */
+  iterator erase(const iterator& pos) { return erase(pos, pos + 1); }
+
+  /**
+   * @brief Erases a range [first;last) of objects. The objects on the shorter
+   * side of the range are shifted to close the gap
+   *
+   * @param first An iterator pointing to the first object to be erased
+   * @param last An iterator pointing behind the last object to be erased
+   * @return iterator An iterator pointing to the object following the erased
+   * objects
+   */
+  iterator erase(const iterator& first, const iterator& last) {
+    size_type count = last - first;
+    size_type index = first - start_;
+    if (count == 0) return first;
+    if (index < size() - index - count) {
+      iterator dest = last;
+      for (iterator src = first; src != start_;) *--dest = ft::move(*--src);
+      for (; count > 0; --count) pop_front();
+    } else {
+      iterator dest = first;
+      for (iterator src = last; src != finish_; ++src, ++dest)
+        *dest = ft::move(*src);
+      for (; count > 0; --count) pop_back();
+    }
+    return begin() + index;
+  }
+
+  /**
+   * @brief Adds an object at the end of the deque
+   *
+   * @param value
+   */
+  void push_back(const value_type& value) {
+    if (!map_) create_map(false);
+    if (finish_.cur_ != finish_.last_ - 1) {
+      allocator_.construct(finish_.cur_, value);
+      ++finish_.cur_;
+      return;
+    }
+    pointer* node = new_block_at_back();
+    try {
+      allocator_.construct(finish_.cur_, value);
+    } catch (...) {
+      deallocate_block(node);
+      throw;
+    }
+    finish_.set_node_(node);
+    finish_.cur_ = finish_.first_;
+  }
+
+  /**
+   * @brief Adds an object at the start of the deque
+   *
+   * @param value
+   */
+  void push_front(const value_type& value) {
+    if (!map_) create_map(true);
+    if (start_.cur_ != start_.first_) {
+      allocator_.construct(start_.cur_ - 1, value);
+      --start_.cur_;
+      return;
+    }
+    pointer* node = new_block_at_front();
+    try {
+      allocator_.construct(*node + block_size() - 1, value);
+    } catch (...) {
+      deallocate_block(node);
+      throw;
+    }
+    start_.set_node_(node);
+    start_.cur_ = start_.last_ - 1;
+  }
+
+#if __cplusplus >= 201103L
+  void push_back(value_type&& value) {
+    if (!map_) create_map(false);
+    if (finish_.cur_ != finish_.last_ - 1) {
+      construct(finish_.cur_, ft::move(value));
+      ++finish_.cur_;
+      return;
+    }
+    pointer* node = new_block_at_back();
+    try {
+      construct(finish_.cur_, ft::move(value));
+    } catch (...) {
+      deallocate_block(node);
+      throw;
+    }
+    finish_.set_node_(node);
+    finish_.cur_ = finish_.first_;
+  }
+
+  void push_front(value_type&& value) {
+    if (!map_) create_map(true);
+    if (start_.cur_ != start_.first_) {
+      construct(start_.cur_ - 1, ft::move(value));
+      --start_.cur_;
+      return;
+    }
+    pointer* node = new_block_at_front();
+    try {
+      construct(*node + block_size() - 1, ft::move(value));
+    } catch (...) {
+      deallocate_block(node);
+      throw;
+    }
+    start_.set_node_(node);
+    start_.cur_ = start_.last_ - 1;
+  }
+#endif
+
+  /**
+   * @brief Removes the last object. A block that becomes empty is given back
+   *
+   */
+  void pop_back() {
+    if (empty()) return;
+    if (finish_.cur_ == finish_.first_) {
+      deallocate_block(finish_.node_);
+      finish_.set_node_(finish_.node_ - 1);
+      finish_.cur_ = finish_.last_;
+    }
+    --finish_.cur_;
+    allocator_.destroy(finish_.cur_);
+  }
+
+  /**
+   * @brief Removes the first object. A block that becomes empty is given back
+   *
+   */
+  void pop_front() {
+    if (empty()) return;
+    allocator_.destroy(start_.cur_);
+    if (start_.cur_ == start_.last_ - 1) {
+      deallocate_block(start_.node_);
+      start_.set_node_(start_.node_ + 1);
+      start_.cur_ = start_.first_;
+    } else {
+      ++start_.cur_;
+    }
+  }
+
+  /**
+   * @brief Resizes the deque to size "count", destroying objects at the end or
+   * adding copies of value there
+   *
+   * @param count new size
+   * @param value value to fill the new space with
+   */
+  void resize(size_type count, value_type value = value_type()) {
+    size_type size = this->size();
+    if (count < size)
+      erase(begin() + count, end());
+    else
+      insert(end(), count - size, value);
+  }
+
+  /**
+   * @brief Swaps the allocator and all objects with another deque
+   *
+   * @param other
+   */
+  void swap(deque& other) {
+    std::swap(this->allocator_, other.allocator_);
+    std::swap(this->map_, other.map_);
+    std::swap(this->map_size_, other.map_size_);
+    std::swap(this->start_, other.start_);
+    std::swap(this->finish_, other.finish_);
+  }
+
+ private:
+  //**************************************************
+  // Member objects
+  //**************************************************
+
+  allocator_type allocator_;
+  pointer* map_;
+  size_type map_size_;
+  iterator start_;
+  iterator finish_;
+
+  //**************************************************
+  // Private member functions
+  //**************************************************
+
+  static size_type block_size() { return iterator::block_size(); }
+
+  /**
+   * @brief Makes sure there is a block behind finish_'s, for a push_back into
+   * the last free slot of finish_'s block
+   *
+   * @return pointer* the map entry of the new block
+   */
+  pointer* new_block_at_back() {
+    reserve_map_at_back(1);
+    pointer* node = finish_.node_ + 1;
+    *node = allocator_.allocate(block_size());
+    return node;
+  }
+
+  /**
+   * @brief Allocates a block in front of start_'s, for a push_front
+   *
+   * @return pointer* the map entry of the new block
+   */
+  pointer* new_block_at_front() {
+    reserve_map_at_front(1);
+    pointer* node = start_.node_ - 1;
+    *node = allocator_.allocate(block_size());
+    return node;
+  }
+
+  void deallocate_block(pointer* node) {
+    allocator_.deallocate(*node, block_size());
+    *node = NULL;
+  }
+
+  // The first map, with a single block in its middle. The deque starts at the
+  // end of the block if it is about to grow at the front
+  void create_map(bool at_front) {
+    map_allocator map_alloc(allocator_);
+    map_size_ = 8;
+    map_ = map_alloc.allocate(map_size_);
+    std::fill(map_, map_ + map_size_, pointer());
+    pointer* node = map_ + map_size_ / 2;
+    try {
+      *node = allocator_.allocate(block_size());
+    } catch (...) {
+      map_alloc.deallocate(map_, map_size_);
+      map_ = NULL;
+      throw;
+    }
+    start_ = iterator(*node + (at_front ? block_size() - 1 : 0), node);
+    finish_ = start_;
+  }
+
+  void reserve_map_at_back(size_type nodes_to_add) {
+    if (nodes_to_add + 1 > map_size_ - (finish_.node_ - map_))
+      reallocate_map(nodes_to_add, false);
+  }
+
+  void reserve_map_at_front(size_type nodes_to_add) {
+    if (nodes_to_add > static_cast<size_type>(start_.node_ - map_))
+      reallocate_map(nodes_to_add, true);
+  }
+
+  /**
+   * @brief Makes room in the map for nodes_to_add more blocks at one end.
+   * Only the block pointers move: if the map is less than half full they are
+   * recentered, otherwise they go to a map twice as big
+   *
+   * @param nodes_to_add
+   * @param add_at_front
+   */
+  void reallocate_map(size_type nodes_to_add, bool add_at_front) {
+    size_type old_nodes = finish_.node_ - start_.node_ + 1;
+    size_type new_nodes = old_nodes + nodes_to_add;
+    pointer* new_start;
+    if (map_size_ > 2 * new_nodes) {
+      new_start = map_ + (map_size_ - new_nodes) / 2 +
+                  (add_at_front ? nodes_to_add : 0);
+      std::memmove(static_cast<void*>(new_start),
+                   static_cast<void*>(start_.node_),
+                   old_nodes * sizeof(pointer));
+      std::fill(map_, new_start, pointer());
+      std::fill(new_start + old_nodes, map_ + map_size_, pointer());
+    } else {
+      map_allocator map_alloc(allocator_);
+      size_type new_map_size =
+          map_size_ + std::max(map_size_, nodes_to_add) + 2;
+      pointer* new_map = map_alloc.allocate(new_map_size);
+      std::fill(new_map, new_map + new_map_size, pointer());
+      new_start = new_map + (new_map_size - new_nodes) / 2 +
+                  (add_at_front ? nodes_to_add : 0);
+      std::copy(start_.node_, finish_.node_ + 1, new_start);
+      map_alloc.deallocate(map_, map_size_);
+      map_ = new_map;
+      map_size_ = new_map_size;
+    }
+    start_.set_node_(new_start);
+    finish_.set_node_(new_start + old_nodes - 1);
+  }
+
+  // Destroys all objects and frees all memory
+  void deallocate_all() {
+    if (!map_) return;
+    clear();
+    deallocate_block(start_.node_);
+    map_allocator(allocator_).deallocate(map_, map_size_);
+    map_ = NULL;
+    map_size_ = 0;
+    start_ = iterator();
+    finish_ = iterator();
+  }
+
+#if __cplusplus >= 201103L
+  template <class U>  // U = value_type
+  void construct(pointer position, U&& value) {
+    std::allocator_traits<allocator_type>::construct(allocator_, position,
+                                                     std::forward<U>(value));
+  }
+#endif
+
+  /**
+   * @brief Destroys the objects in the range [first;last)
+   *
+   * @param first
+   * @param last
+   */
+  void destroy(iterator first, iterator last) {
+    if (ft::is_integral<value_type>::value) return;
+    for (; first != last; ++first) allocator_.destroy(first.cur_);
+  }
+};
+
+//**************************************************
+// Non-member operator overloads
+//**************************************************
+
+template <class T, class Alloc>
+bool operator==(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+  if (lhs.size() != rhs.size()) return false;
+  return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class T, class Alloc>
+bool operator!=(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <class T, class Alloc>
+bool operator<(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+  return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                     rhs.end());
+}
+
+template <class T, class Alloc>
+bool operator>(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+  return rhs < lhs;
+}
+
+template <class T, class Alloc>
+bool operator<=(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+  return !(rhs < lhs);
+}
+
+template <class T, class Alloc>
+bool operator>=(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+  return !(lhs < rhs);
+}
+
+}  // namespace ft
+// std::swap specialization for ft::deque
+namespace std {
+template <class T, class Alloc>
+void swap(ft::deque<T, Alloc>& lhs, ft::deque<T, Alloc>& rhs) {
+  lhs.swap(rhs);
+}
+}  // namespace std
+
+#endif  // DEQUE_H
@@ -0,0 +1,319 @@
+#ifndef EYTZINGER_H
+#define EYTZINGER_H
+
+#include "iterator_eytzinger.hpp"
+#include "utilities.hpp"
+
+namespace ft {
+
+// An immutable binary search tree without pointers: the values lie in one
+// array in Eytzinger order, the order of a breadth-first walk. The root is
+// at index 1, the children of index k at 2k and 2k + 1, so a search computes
+// the next index instead of loading it: k = 2k + (key at k < key). The
+// comparison turns into a conditional add, not a branch.
+//
+// The top levels of the tree share a few cache lines that stay cached. Below
+// them, the 2^d descendants of index k that lie d levels further down are
+// neighbours at k * 2^d. With 2^d the number of values that fit in 64 bytes,
+// rounded down to a power of two (16 for 4 byte values, d = 4), they share
+// one cache line, since the array is aligned to one (values whose size is
+// not a power of two may spill into the next line). A search prefetches
+// that line while it compares the next levels, so it waits for memory about
+// every d-th level instead of every level.
+//
+// Built in O(n) from a range that is sorted and free of duplicates, like the
+// elements of a map. Index 0 is end(). Stores a value_type, KeyOfValue
+// extracts the key that Compare works on.
+template <class T, class Compare, class Allocator = std::allocator<T>,
+          class KeyOfValue = ft::identity<T> >
+class eytzinger {
+ public:
+  //**************************************************
+  // Typedefs
+  //**************************************************
+
+  typedef typename KeyOfValue::result_type key_type;
+  typedef T value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Compare key_compare;
+  typedef Allocator allocator_type;
+  typedef typename Allocator::pointer pointer;
+
+  typedef iterator_eytzinger<const value_type> const_iterator;
+
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  eytzinger(const key_compare& comp,
+            const allocator_type& alloc = allocator_type())
+      : allocator_(alloc),
+        comp_(comp),
+        buffer_(NULL),
+        values_(NULL),
+        capacity_(0),
+        size_(0) {}
+
+  /**
+   * @brief Builds the tree from the n values starting at first, which must
+   * be sorted by key and have no two equal keys
+   *
+   * @param first
+   * @param n
+   * @param comp
+   * @param alloc
+   */
+  template <class InputIt>
+  eytzinger(InputIt first, size_type n, const key_compare& comp,
+            const allocator_type& alloc = allocator_type())
+      : allocator_(alloc),
+        comp_(comp),
+        buffer_(NULL),
+        values_(NULL),
+        capacity_(0),
+        size_(0) {
+    if (n == 0) return;
+    allocate_(n);
+    size_ = n;
+    // The in-order walk of the tree visits the indices in key order
+    size_type built = 0;
+    try {
+      for (size_type k = first_index_(); built < n; ++built, ++first) {
+        allocator_.construct(values_ + k, *first);
+        k = next_index_(k);
+      }
+    } catch (...) {
+      destroy_(built);
+      deallocate_();
+      throw;
+    }
+  }
+
+  // Same shape, so every value is copied to the same index
+  eytzinger(const eytzinger& other)
+      : allocator_(other.allocator_),
+        comp_(other.comp_),
+        buffer_(NULL),
+        values_(NULL),
+        capacity_(0),
+        size_(0) {
+    if (other.size_ == 0) return;
+    allocate_(other.size_);
+    size_ = other.size_;
+    size_type k = 1;
+    try {
+      for (; k <= size_; ++k)
+        allocator_.construct(values_ + k, other.values_[k]);
+    } catch (...) {
+      for (size_type i = 1; i < k; ++i) allocator_.destroy(values_ + i);
+      deallocate_();
+      throw;
+    }
+  }
+
+  ~eytzinger() {
+    destroy_(size_);
+    deallocate_();
+  }
+
+  eytzinger& operator=(const eytzinger& other) {
+    if (this != &other) {
+      eytzinger tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  //**************************************************
+  // Iterators
+  //**************************************************
+
+  const_iterator begin() const { return iterator_at(first_index_()); }
+  const_iterator end() const { return iterator_at(0); }
+
+  const_iterator iterator_at(size_type index) const {
+    return const_iterator(values_, index, size_);
+  }
+
+  //**************************************************
+  // Capacity
+  //**************************************************
+
+  size_type size() const { return size_; }
+  size_type max_size() const { return allocator_.max_size() / 2; }
+
+  //**************************************************
+  // Modifiers
+  //**************************************************
+
+  void swap(eytzinger& other) {
+    std::swap(allocator_, other.allocator_);
+    std::swap(comp_, other.comp_);
+    std::swap(buffer_, other.buffer_);
+    std::swap(values_, other.values_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+  }
+
+  //**************************************************
+  // Lookup
+  //**************************************************
+
+  /**
+   * @brief Index of the first value whose key is not less than key. The
+   * descent goes right past every key less than key, the lower bound is
+   * where it went left for the last time: the index without its trailing 1
+   * bits and the 0 before them
+   *
+   * @param key
+   * @return size_type index, 0 (end) if there is none
+   */
+  size_type lower_bound(const key_type& key) const {
+    size_type k = 1;
+    while (k <= size_) {
+      prefetch_(k * prefetch_stride_);
+      k = 2 * k + comp_(key_of_(values_[k]), key);
+    }
+    return k >> (trailing_ones_(k) + 1);
+  }
+
+  // Index of the first value whose key is greater than key, 0 if there is none
+  size_type upper_bound(const key_type& key) const {
+    size_type k = 1;
+    while (k <= size_) {
+      prefetch_(k * prefetch_stride_);
+      k = 2 * k + !comp_(key, key_of_(values_[k]));
+    }
+    return k >> (trailing_ones_(k) + 1);
+  }
+
+  // Index of the value with key, 0 if there is none
+  size_type find(const key_type& key) const {
+    size_type k = lower_bound(key);
+    if (k && comp_(key, key_of_(values_[k]))) return 0;
+    return k;
+  }
+
+  //**************************************************
+  // Observers
+  //**************************************************
+
+  allocator_type get_allocator() const { return allocator_; }
+  key_compare key_comp() const { return comp_; }
+
+ private:
+  static const size_type cache_line_ = 64;
+
+  static const size_type values_per_line_ = cache_line_ / sizeof(T);
+
+  // Distance from index k to the descendants prefetched for it. Only a power
+  // of two lands on the descendants of k, so the values of one cache line
+  // are rounded down to one (and are at least the 2 children)
+  static const size_type prefetch_stride_ =
+      values_per_line_ >= 64   ? 64
+      : values_per_line_ >= 32 ? 32
+      : values_per_line_ >= 16 ? 16
+      : values_per_line_ >= 8  ? 8
+      : values_per_line_ >= 4  ? 4
+                               : 2;
+
+  const key_type& key_of_(const value_type& value) const {
+    return KeyOfValue()(value);
+  }
+
+  /**
+   * @brief Asks for the cache line of the value at index to be loaded, so a
+   * later load doesn't stall. index may lie far past the array, where even
+   * forming values_ + index is undefined, so the address is computed as an
+   * integer. The hint for such an address is dropped. A no-op on compilers
+   * without __builtin_prefetch
+   *
+   * @param index
+   */
+  void prefetch_(size_type index) const {
+#ifdef __GNUC__
+    __builtin_prefetch(reinterpret_cast<const void*>(
+        reinterpret_cast<std::size_t>(values_) + index * sizeof(value_type)));
+#else
+    (void)index;
+#endif
+  }
+
+  static unsigned trailing_ones_(size_type k) {
+#ifdef __GNUC__
+    unsigned long ones = ~static_cast<unsigned long>(k);
+    return static_cast<unsigned>(__builtin_ctzl(ones));
+#else
+    unsigned i = 0;
+    while (k & 1) {
+      k >>= 1;
+      ++i;
+    }
+    return i;
+#endif
+  }
+
+  // The smallest value, at the end of the leftmost path
+  size_type first_index_() const {
+    if (size_ == 0) return 0;
+    size_type k = 1;
+    while (2 * k <= size_) k *= 2;
+    return k;
+  }
+
+  // The in-order successor of index k, 0 after the last one
+  size_type next_index_(size_type k) const {
+    if (2 * k + 1 <= size_) {
+      k = 2 * k + 1;
+      while (2 * k <= size_) k *= 2;
+      return k;
+    }
+    return k >> (trailing_ones_(k) + 1);
+  }
+
+  /**
+   * @brief Allocates room for indices 0 to n, with index 0 at the start of a
+   * cache line so the values prefetched together share one. The buffer has
+   * one line more than needed to make room for the shift
+   *
+   * @param n
+   */
+  void allocate_(size_type n) {
+    size_type slack = cache_line_ / sizeof(T) + 1;
+    capacity_ = n + 1 + slack;
+    buffer_ = allocator_.allocate(capacity_);
+    std::size_t address = reinterpret_cast<std::size_t>(&*buffer_);
+    std::size_t shift = (cache_line_ - address % cache_line_) % cache_line_;
+    values_ = buffer_;
+    if (shift % sizeof(T) == 0) values_ += shift / sizeof(T);
+  }
+
+  void deallocate_() {
+    if (buffer_) allocator_.deallocate(buffer_, capacity_);
+    buffer_ = NULL;
+    values_ = NULL;
+    capacity_ = 0;
+    size_ = 0;
+  }
+
+  // Destroys the first count values in key order
+  void destroy_(size_type count) {
+    size_type k = first_index_();
+    for (size_type i = 0; i < count; ++i) {
+      allocator_.destroy(values_ + k);
+      k = next_index_(k);
+    }
+  }
+
+  allocator_type allocator_;
+  key_compare comp_;
+  pointer buffer_;
+  pointer values_;
+  size_type capacity_;
+  size_type size_;
+};
+
+}  // namespace ft
+
+#endif  // EYTZINGER_H
@@ -0,0 +1,86 @@
+#ifndef FLAT_HASH_MAP_H
+#define FLAT_HASH_MAP_H
+
+#include "swisstable.hpp"
+#include "unordered_map_base.hpp"
+#include "utilities.hpp"
+
+namespace ft {
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::flat_hash_map
+//
+// ft::unordered_map for hot lookup tables, backed by a swisstable: a lookup
+// compares 7 bits of the hash of 16 slots at once (with SSE2) and only then
+// compares keys, so the table stays fast up to a load of 7/8. Same interface
+// and value_type (ft::pair<const Key, T>) as ft::map and ft::unordered_map,
+// switching is a typedef.
+//
+// Like ft::unordered_map, a rehash invalidates references to the values as
+// well as iterators. Erasing only invalidates the erased element.
+//////////////////////////////////////////////////////////////////////////////
+
+template <class Key, class T, class Hash = ft::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<ft::pair<const Key, T> > >
+class flat_hash_map
+    : public unordered_map_base<
+          Key, T, Hash, KeyEqual, Allocator,
+          swisstable<ft::pair<const Key, T>, Hash, KeyEqual, Allocator,
+                     ft::select_first<ft::pair<const Key, T> > > > {
+  typedef unordered_map_base<
+      Key, T, Hash, KeyEqual, Allocator,
+      swisstable<ft::pair<const Key, T>, Hash, KeyEqual, Allocator,
+                 ft::select_first<ft::pair<const Key, T> > > >
+      base_type;
+
+ public:
+  typedef typename base_type::size_type size_type;
+
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  flat_hash_map() : base_type(0, Hash(), KeyEqual(), Allocator()) {}
+
+  explicit flat_hash_map(size_type bucket_count, const Hash& hash = Hash(),
+                         const KeyEqual& equal = KeyEqual(),
+                         const Allocator& alloc = Allocator())
+      : base_type(bucket_count, hash, equal, alloc) {}
+
+  template <class InputIt>
+  flat_hash_map(InputIt first, InputIt last, size_type bucket_count = 0,
+                const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(),
+                const Allocator& alloc = Allocator())
+      : base_type(bucket_count, hash, equal, alloc) {
+    this->insert(first, last);
+  }
+
+  flat_hash_map(const flat_hash_map& other) : base_type(other) {}
+
+  ~flat_hash_map() {}
+
+  //**************************************************
+  // Operator overloads
+  //**************************************************
+
+  flat_hash_map& operator=(const flat_hash_map& other) {
+    base_type::operator=(other);
+    return *this;
+  }
+};
+
+}  // namespace ft
+
+namespace std {
+
+// Specialization of the std::swap function
+template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+void swap(ft::flat_hash_map<Key, T, Hash, KeyEqual, Alloc>& lhs,
+          ft::flat_hash_map<Key, T, Hash, KeyEqual, Alloc>& rhs) {
+  lhs.swap(rhs);
+}
+
+}  // namespace std
+
+#endif  // FLAT_HASH_MAP_H
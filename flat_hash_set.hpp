@@ -0,0 +1,77 @@
+#ifndef FLAT_HASH_SET_H
+#define FLAT_HASH_SET_H
+
+#include "swisstable.hpp"
+#include "unordered_set_base.hpp"
+#include "utilities.hpp"
+
+namespace ft {
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::flat_hash_set
+//
+// Set of keys without an order, backed by the same swisstable as
+// ft::flat_hash_map. A rehash invalidates iterators and references, an erase
+// only those to the erased key.
+//////////////////////////////////////////////////////////////////////////////
+
+template <class Key, class Hash = ft::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<Key> >
+class flat_hash_set
+    : public unordered_set_base<Key, Hash, KeyEqual, Allocator,
+                                swisstable<Key, Hash, KeyEqual, Allocator> > {
+  typedef unordered_set_base<Key, Hash, KeyEqual, Allocator,
+                             swisstable<Key, Hash, KeyEqual, Allocator> >
+      base_type;
+
+ public:
+  typedef typename base_type::size_type size_type;
+
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  flat_hash_set() : base_type(0, Hash(), KeyEqual(), Allocator()) {}
+
+  explicit flat_hash_set(size_type bucket_count, const Hash& hash = Hash(),
+                         const KeyEqual& equal = KeyEqual(),
+                         const Allocator& alloc = Allocator())
+      : base_type(bucket_count, hash, equal, alloc) {}
+
+  template <class InputIt>
+  flat_hash_set(InputIt first, InputIt last, size_type bucket_count = 0,
+                const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(),
+                const Allocator& alloc = Allocator())
+      : base_type(bucket_count, hash, equal, alloc) {
+    this->insert(first, last);
+  }
+
+  flat_hash_set(const flat_hash_set& other) : base_type(other) {}
+
+  ~flat_hash_set() {}
+
+  //**************************************************
+  // Operator overloads
+  //**************************************************
+
+  flat_hash_set& operator=(const flat_hash_set& other) {
+    base_type::operator=(other);
+    return *this;
+  }
+};
+
+}  // namespace ft
+
+namespace std {
+
+// Specialization of the std::swap function
+template <class Key, class Hash, class KeyEqual, class Alloc>
+void swap(ft::flat_hash_set<Key, Hash, KeyEqual, Alloc>& lhs,
+          ft::flat_hash_set<Key, Hash, KeyEqual, Alloc>& rhs) {
+  lhs.swap(rhs);
+}
+
+}  // namespace std
+
+#endif  // FLAT_HASH_SET_H
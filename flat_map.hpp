@@ -0,0 +1,425 @@
+#ifndef FLAT_MAP_H
+#define FLAT_MAP_H
+
+#include "iterator_vector.hpp"
+#include "sorted_vector.hpp"
+#include "utilities.hpp"
+
+namespace ft {
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::flat_map
+//
+// Sorted key-value container with the interface of ft::map, for tables that
+// are filled once and then queried: the elements lie sorted in one ft::vector
+// and a lookup is a binary search over it. Without the three pointers and the
+// color of a tree node and without one allocation per element, an element
+// takes sizeof(value_type) bytes. Iterating is walking an array.
+//
+// Inserting or erasing a single element moves all elements behind it and
+// invalidates all iterators and references behind it (all of them if the
+// vector grows). Insert ranges in one call, which sorts and merges them.
+//////////////////////////////////////////////////////////////////////////////
+
+template <class Key, class T, class Compare = std::less<Key>,
+          class Allocator = std::allocator<ft::pair<const Key, T> > >
+class flat_map {
+ public:
+  //**************************************************
+  // Typedefs
+  //**************************************************
+
+  typedef Key key_type;
+  typedef T mapped_type;
+  typedef ft::pair<const Key, T> value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Compare key_compare;
+  typedef Allocator allocator_type;
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef typename Allocator::pointer pointer;
+  typedef typename Allocator::const_pointer const_pointer;
+
+  typedef sorted_vector<value_type, key_compare, allocator_type,
+                        ft::select_first<value_type> >
+      table_type;
+
+  typedef Iterator_vector<value_type> iterator;
+  typedef Iterator_vector<const value_type> const_iterator;
+  typedef ft::reverse_iterator<iterator> reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  flat_map() : table_(key_compare(), allocator_type()) {}
+
+  explicit flat_map(const Compare& comp, const Allocator& alloc = Allocator())
+      : table_(comp, alloc) {}
+
+  template <class InputIt>
+  flat_map(InputIt first, InputIt last, const Compare& comp = Compare(),
+           const Allocator& alloc = Allocator())
+      : table_(comp, alloc) {
+    insert(first, last);
+  }
+
+  flat_map(const flat_map& other) : table_(other.table_) {}
+
+  ~flat_map() {}
+
+  //**************************************************
+  // Member classes
+  //**************************************************
+
+  class value_compare {
+   public:
+    typedef bool result_type;
+    typedef value_type first_argument_type;
+    typedef value_type second_argument_type;
+
+    value_compare() : comp(key_compare()) {}
+    value_compare(key_compare c) : comp(c) {}
+    bool operator()(const value_type& lhs, const value_type& rhs) const {
+      return comp(lhs.first, rhs.first);
+    }
+
+   protected:
+    key_compare comp;
+  };
+
+  //**************************************************
+  // Operator overloads
+  //**************************************************
+
+  flat_map& operator=(const flat_map& other) {
+    table_ = other.table_;
+    return *this;
+  }
+
+  //**************************************************
+  // Member functions
+  //**************************************************
+
+  allocator_type get_allocator() const { return table_.get_allocator(); }
+
+  //**************************************************
+  // Element access
+  //**************************************************
+
+  mapped_type& at(const Key& key) {
+    iterator ret = find(key);
+    if (ret == end()) throw std::out_of_range("No element with key found");
+    return (*ret).second;
+  }
+
+  const mapped_type& at(const Key& key) const {
+    const_iterator ret = find(key);
+    if (ret == end()) throw std::out_of_range("No element with key found");
+    return (*ret).second;
+  }
+
+  mapped_type& operator[](const Key& key) {
+    return (*try_emplace(key).first).second;
+  }
+
+  //**************************************************
+  // Iterators
+  //**************************************************
+
+  iterator begin() { return table_.begin(); }
+  const_iterator begin() const { return table_.begin(); }
+  iterator end() { return table_.end(); }
+  const_iterator end() const { return table_.end(); }
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(end());
+  }
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(begin());
+  }
+
+  //**************************************************
+  // Capacity
+  //**************************************************
+
+  bool empty() const { return (size() == 0); }
+  size_type size() const { return table_.size(); }
+  size_type max_size() const { return table_.max_size(); }
+
+  // The vector's capacity: elements that fit before it grows
+  size_type capacity() const { return table_.capacity(); }
+  void reserve(size_type new_cap) { table_.reserve(new_cap); }
+  void shrink_to_fit() { table_.shrink_to_fit(); }
+
+  //**************************************************
+  // Modifiers
+  //**************************************************
+
+  void clear() { table_.clear(); }
+
+  ft::pair<iterator, bool> insert(const value_type& value) {
+    ft::pair<size_type, bool> tmp = table_.insert(value);
+    return ft::pair<iterator, bool>(table_.iterator_at(tmp.first), tmp.second);
+  }
+
+  /**
+   * @brief Inserts a value-initialized element with key if there is none yet.
+   * The vector is searched once and the element is only built if it is
+   * missing
+   *
+   * @param key
+   * @return ft::pair<iterator, bool> iterator to the element with key and
+   * whether it was inserted
+   */
+  ft::pair<iterator, bool> try_emplace(const key_type& key) {
+    ft::pair<size_type, bool> position = table_.find_position(key);
+    if (position.second)
+      return ft::pair<iterator, bool>(table_.iterator_at(position.first),
+                                      false);
+    return ft::pair<iterator, bool>(
+        table_.iterator_at(
+            table_.insert_at(position.first, value_type(key, mapped_type()))),
+        true);
+  }
+
+  /**
+   * @brief Inserts (key, obj) if there is no element with key yet. obj is only
+   * copied if the element is inserted
+   *
+   * @param key
+   * @param obj
+   * @return ft::pair<iterator, bool> iterator to the element with key and
+   * whether it was inserted
+   */
+  ft::pair<iterator, bool> try_emplace(const key_type& key,
+                                       const mapped_type& obj) {
+    ft::pair<size_type, bool> position = table_.find_position(key);
+    if (position.second)
+      return ft::pair<iterator, bool>(table_.iterator_at(position.first),
+                                      false);
+    return ft::pair<iterator, bool>(
+        table_.iterator_at(
+            table_.insert_at(position.first, value_type(key, obj))),
+        true);
+  }
+
+  /**
+   * @brief Assigns obj to the element with key, or inserts (key, obj) if there
+   * is none. The vector is searched once
+   *
+   * @param key
+   * @param obj
+   * @return ft::pair<iterator, bool> iterator to the element with key and
+   * whether it was inserted
+   */
+  ft::pair<iterator, bool> insert_or_assign(const key_type& key,
+                                            const mapped_type& obj) {
+    ft::pair<size_type, bool> position = table_.find_position(key);
+    if (position.second) {
+      iterator it = table_.iterator_at(position.first);
+      it->second = obj;
+      return ft::pair<iterator, bool>(it, false);
+    }
+    return ft::pair<iterator, bool>(
+        table_.iterator_at(
+            table_.insert_at(position.first, value_type(key, obj))),
+        true);
+  }
+
+  // Only one comparison on each side of pos if value belongs right before it
+  iterator insert(const_iterator pos, const value_type& value) {
+    return table_.iterator_at(table_.insert(table_.index_of(pos), value));
+  }
+
+  template <class InputIt>
+  void insert(InputIt first, InputIt last) {
+    table_.insert_range(first, last);
+  }
+
+  iterator erase(const_iterator pos) {
+    return table_.iterator_at(table_.erase_at(table_.index_of(pos)));
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    size_type index = table_.index_of(first);
+    table_.erase(index, table_.index_of(last));
+    return table_.iterator_at(index);
+  }
+
+  size_type erase(const Key& key) {
+    bool erased = table_.erase(key);
+    return erased;
+  }
+
+  void swap(flat_map& other) { table_.swap(other.table_); }
+
+  //**************************************************
+  // Lookup
+  //**************************************************
+
+  size_type count(const Key& key) const {
+    return table_.find_position(key).second ? 1 : 0;
+  }
+
+  iterator find(const Key& key) {
+    return table_.iterator_at(table_.find(key));
+  }
+
+  const_iterator find(const Key& key) const {
+    return table_.iterator_at(table_.find(key));
+  }
+
+  ft::pair<iterator, iterator> equal_range(const Key& key) {
+    return ft::make_pair(lower_bound(key), upper_bound(key));
+  }
+  ft::pair<const_iterator, const_iterator> equal_range(const Key& key) const {
+    return ft::make_pair(lower_bound(key), upper_bound(key));
+  }
+  iterator lower_bound(const Key& key) {
+    return table_.iterator_at(table_.lower_bound(key));
+  }
+  const_iterator lower_bound(const Key& key) const {
+    return table_.iterator_at(table_.lower_bound(key));
+  }
+  iterator upper_bound(const Key& key) {
+    return table_.iterator_at(table_.upper_bound(key));
+  }
+  const_iterator upper_bound(const Key& key) const {
+    return table_.iterator_at(table_.upper_bound(key));
+  }
+
+  /**
+   * @brief writes find(key) to out for every key in [first;last). The
+   * searches of several keys run side by side, so their cache misses overlap
+   *
+   * @param first
+   * @param last
+   * @param out receives one iterator per key
+   * @return OutputIt out past the last written iterator
+   */
+  template <class ForwardIt, class OutputIt>
+  OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) {
+    return table_.template find_batch<iterator>(first, last, out);
+  }
+  template <class ForwardIt, class OutputIt>
+  OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const {
+    return table_.template find_batch<const_iterator>(first, last, out);
+  }
+
+  /**
+   * @brief writes lower_bound(key) to out for every key in [first;last), see
+   * find_batch
+   */
+  template <class ForwardIt, class OutputIt>
+  OutputIt lower_bound_batch(ForwardIt first, ForwardIt last, OutputIt out) {
+    return table_.template lower_bound_batch<iterator>(first, last, out);
+  }
+  template <class ForwardIt, class OutputIt>
+  OutputIt lower_bound_batch(ForwardIt first, ForwardIt last,
+                             OutputIt out) const {
+    return table_.template lower_bound_batch<const_iterator>(first, last, out);
+  }
+
+  /**
+   * @brief find_batch for keys in ascending order. Every search starts at the
+   * result of the previous key and first looks close by
+   */
+  template <class ForwardIt, class OutputIt>
+  OutputIt find_batch_sorted(ForwardIt first, ForwardIt last, OutputIt out) {
+    return table_.template find_batch_sorted<iterator>(first, last, out);
+  }
+  template <class ForwardIt, class OutputIt>
+  OutputIt find_batch_sorted(ForwardIt first, ForwardIt last,
+                             OutputIt out) const {
+    return table_.template find_batch_sorted<const_iterator>(first, last, out);
+  }
+
+  /**
+   * @brief lower_bound_batch for keys in ascending order, see
+   * find_batch_sorted
+   */
+  template <class ForwardIt, class OutputIt>
+  OutputIt lower_bound_batch_sorted(ForwardIt first, ForwardIt last,
+                                    OutputIt out) {
+    return table_.template lower_bound_batch_sorted<iterator>(first, last,
+                                                              out);
+  }
+  template <class ForwardIt, class OutputIt>
+  OutputIt lower_bound_batch_sorted(ForwardIt first, ForwardIt last,
+                                    OutputIt out) const {
+    return table_.template lower_bound_batch_sorted<const_iterator>(first, last,
+                                                                    out);
+  }
+
+  //**************************************************
+  // Observers
+  //**************************************************
+
+  key_compare key_comp() const { return table_.key_comp(); }
+
+  value_compare value_comp() const { return value_compare(table_.key_comp()); }
+
+ private:
+  table_type table_;
+};
+
+//**************************************************
+// Non-member functions
+//**************************************************
+
+template <class Key, class T, class Compare, class Alloc>
+bool operator==(const ft::flat_map<Key, T, Compare, Alloc>& lhs,
+                const ft::flat_map<Key, T, Compare, Alloc>& rhs) {
+  if (lhs.size() != rhs.size()) return false;
+  return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool operator!=(const ft::flat_map<Key, T, Compare, Alloc>& lhs,
+                const ft::flat_map<Key, T, Compare, Alloc>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool operator<(const ft::flat_map<Key, T, Compare, Alloc>& lhs,
+               const ft::flat_map<Key, T, Compare, Alloc>& rhs) {
+  return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                     rhs.end());
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool operator>(const ft::flat_map<Key, T, Compare, Alloc>& lhs,
+               const ft::flat_map<Key, T, Compare, Alloc>& rhs) {
+  return rhs < lhs;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool operator<=(const ft::flat_map<Key, T, Compare, Alloc>& lhs,
+                const ft::flat_map<Key, T, Compare, Alloc>& rhs) {
+  return !(rhs < lhs);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool operator>=(const ft::flat_map<Key, T, Compare, Alloc>& lhs,
+                const ft::flat_map<Key, T, Compare, Alloc>& rhs) {
+  return !(lhs < rhs);
+}
+
+}  // namespace ft
+
+namespace std {
+
+// Specialization of the std::swap function
+template <class Key, class T, class Compare, class Alloc>
+void swap(ft::flat_map<Key, T, Compare, Alloc>& lhs,
+          ft::flat_map<Key, T, Compare, Alloc>& rhs) {
+  lhs.swap(rhs);
+}
+
+}  // namespace std
+
+#endif  // FLAT_MAP_H
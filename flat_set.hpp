@@ -0,0 +1,280 @@
+#ifndef FLAT_SET_H
+#define FLAT_SET_H
+
+#include "iterator_vector.hpp"
+#include "sorted_vector.hpp"
+#include "utilities.hpp"
+
+namespace ft {
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::flat_set
+//
+// Sorted set of keys with the interface of ft::set, kept in one ft::vector
+// like ft::flat_map. Inserting or erasing a single key invalidates the
+// iterators behind it (all of them if the vector grows).
+//////////////////////////////////////////////////////////////////////////////
+
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key> >
+class flat_set {
+ public:
+  //**************************************************
+  // Typedefs
+  //**************************************************
+
+  typedef Key key_type;
+  typedef Key value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Compare key_compare;
+  typedef Compare value_compare;
+  typedef Allocator allocator_type;
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef typename Allocator::pointer pointer;
+  typedef typename Allocator::const_pointer const_pointer;
+
+  typedef sorted_vector<value_type, value_compare, allocator_type> table_type;
+
+  typedef Iterator_vector<const value_type> iterator;  // Key always const
+  typedef Iterator_vector<const value_type> const_iterator;
+  typedef ft::reverse_iterator<iterator> reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  flat_set() : table_(value_compare(), allocator_type()) {}
+
+  explicit flat_set(const Compare& comp, const Allocator& alloc = Allocator())
+      : table_(comp, alloc) {}
+
+  template <class InputIt>
+  flat_set(InputIt first, InputIt last, const Compare& comp = Compare(),
+           const Allocator& alloc = Allocator())
+      : table_(comp, alloc) {
+    insert(first, last);
+  }
+
+  flat_set(const flat_set& other) : table_(other.table_) {}
+
+  ~flat_set() {}
+
+  //**************************************************
+  // Operator overloads
+  //**************************************************
+
+  flat_set& operator=(const flat_set& other) {
+    table_ = other.table_;
+    return *this;
+  }
+
+  //**************************************************
+  // Member functions
+  //**************************************************
+
+  allocator_type get_allocator() const { return table_.get_allocator(); }
+
+  //**************************************************
+  // Iterators
+  //**************************************************
+
+  iterator begin() const { return constant_table_().begin(); }
+  iterator end() const { return constant_table_().end(); }
+  reverse_iterator rbegin() const { return reverse_iterator(end()); }
+  reverse_iterator rend() const { return reverse_iterator(begin()); }
+
+  //**************************************************
+  // Capacity
+  //**************************************************
+
+  bool empty() const { return (size() == 0); }
+  size_type size() const { return table_.size(); }
+  size_type max_size() const { return table_.max_size(); }
+
+  // The vector's capacity: keys that fit before it grows
+  size_type capacity() const { return table_.capacity(); }
+  void reserve(size_type new_cap) { table_.reserve(new_cap); }
+  void shrink_to_fit() { table_.shrink_to_fit(); }
+
+  //**************************************************
+  // Modifiers
+  //**************************************************
+
+  void clear() { table_.clear(); }
+
+  ft::pair<iterator, bool> insert(const value_type& value) {
+    ft::pair<size_type, bool> tmp = table_.insert(value);
+    return ft::pair<iterator, bool>(constant_table_().iterator_at(tmp.first),
+                                    tmp.second);
+  }
+
+  // Only one comparison on each side of pos if value belongs right before it
+  iterator insert(const_iterator pos, const value_type& value) {
+    return constant_table_().iterator_at(
+        table_.insert(table_.index_of(pos), value));
+  }
+
+  template <class InputIt>
+  void insert(InputIt first, InputIt last) {
+    table_.insert_range(first, last);
+  }
+
+  iterator erase(const_iterator pos) {
+    return constant_table_().iterator_at(
+        table_.erase_at(table_.index_of(pos)));
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    size_type index = table_.index_of(first);
+    table_.erase(index, table_.index_of(last));
+    return constant_table_().iterator_at(index);
+  }
+
+  size_type erase(const Key& key) {
+    bool erased = table_.erase(key);
+    return erased;
+  }
+
+  void swap(flat_set& other) { table_.swap(other.table_); }
+
+  //**************************************************
+  // Lookup
+  //**************************************************
+
+  size_type count(const Key& key) const {
+    return table_.find_position(key).second ? 1 : 0;
+  }
+
+  iterator find(const Key& key) const {
+    return table_.iterator_at(table_.find(key));
+  }
+
+  ft::pair<iterator, iterator> equal_range(const Key& key) const {
+    return ft::make_pair(lower_bound(key), upper_bound(key));
+  }
+  iterator lower_bound(const Key& key) const {
+    return table_.iterator_at(table_.lower_bound(key));
+  }
+  iterator upper_bound(const Key& key) const {
+    return table_.iterator_at(table_.upper_bound(key));
+  }
+
+  /**
+   * @brief writes find(key) to out for every key in [first;last). The
+   * searches of several keys run side by side, so their cache misses overlap
+   *
+   * @param first
+   * @param last
+   * @param out receives one iterator per key
+   * @return OutputIt out past the last written iterator
+   */
+  template <class ForwardIt, class OutputIt>
+  OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const {
+    return table_.template find_batch<const_iterator>(first, last, out);
+  }
+
+  /**
+   * @brief writes lower_bound(key) to out for every key in [first;last), see
+   * find_batch
+   */
+  template <class ForwardIt, class OutputIt>
+  OutputIt lower_bound_batch(ForwardIt first, ForwardIt last,
+                             OutputIt out) const {
+    return table_.template lower_bound_batch<const_iterator>(first, last, out);
+  }
+
+  /**
+   * @brief find_batch for keys in ascending order. Every search starts at the
+   * result of the previous key and first looks close by
+   */
+  template <class ForwardIt, class OutputIt>
+  OutputIt find_batch_sorted(ForwardIt first, ForwardIt last,
+                             OutputIt out) const {
+    return table_.template find_batch_sorted<const_iterator>(first, last, out);
+  }
+
+  /**
+   * @brief lower_bound_batch for keys in ascending order, see
+   * find_batch_sorted
+   */
+  template <class ForwardIt, class OutputIt>
+  OutputIt lower_bound_batch_sorted(ForwardIt first, ForwardIt last,
+                                    OutputIt out) const {
+    return table_.template lower_bound_batch_sorted<const_iterator>(first, last,
+                                                                    out);
+  }
+
+  //**************************************************
+  // Observers
+  //**************************************************
+
+  key_compare key_comp() const { return table_.key_comp(); }
+
+  value_compare value_comp() const { return table_.key_comp(); }
+
+ private:
+  // The table's const functions hand out const_iterators
+  const table_type& constant_table_() const { return table_; }
+
+  table_type table_;
+};
+
+//**************************************************
+// Non-member functions
+//**************************************************
+
+template <class Key, class Compare, class Alloc>
+bool operator==(const ft::flat_set<Key, Compare, Alloc>& lhs,
+                const ft::flat_set<Key, Compare, Alloc>& rhs) {
+  if (lhs.size() != rhs.size()) return false;
+  return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class Key, class Compare, class Alloc>
+bool operator!=(const ft::flat_set<Key, Compare, Alloc>& lhs,
+                const ft::flat_set<Key, Compare, Alloc>& rhs) {
+  return !(lhs == rhs);
+}
+
+template <class Key, class Compare, class Alloc>
+bool operator<(const ft::flat_set<Key, Compare, Alloc>& lhs,
+               const ft::flat_set<Key, Compare, Alloc>& rhs) {
+  return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                     rhs.end());
+}
+
+template <class Key, class Compare, class Alloc>
+bool operator>(const ft::flat_set<Key, Compare, Alloc>& lhs,
+               const ft::flat_set<Key, Compare, Alloc>& rhs) {
+  return rhs < lhs;
+}
+
+template <class Key, class Compare, class Alloc>
+bool operator<=(const ft::flat_set<Key, Compare, Alloc>& lhs,
+                const ft::flat_set<Key, Compare, Alloc>& rhs) {
+  return !(rhs < lhs);
+}
+
+template <class Key, class Compare, class Alloc>
+bool operator>=(const ft::flat_set<Key, Compare, Alloc>& lhs,
+                const ft::flat_set<Key, Compare, Alloc>& rhs) {
+  return !(lhs < rhs);
+}
+
+}  // namespace ft
+
+namespace std {
+
+// Specialization of the std::swap function
+template <class Key, class Compare, class Alloc>
+void swap(ft::flat_set<Key, Compare, Alloc>& lhs,
+          ft::flat_set<Key, Compare, Alloc>& rhs) {
+  lhs.swap(rhs);
+}
+
+}  // namespace std
+
+#endif  // FLAT_SET_H
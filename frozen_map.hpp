@@ -0,0 +1,223 @@
+#ifndef FROZEN_MAP_H
+#define FROZEN_MAP_H
+
+#include "eytzinger.hpp"
+#include "iterator_eytzinger.hpp"
+#include "utilities.hpp"
+
+namespace ft {
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::frozen_map
+//
+// Read-only snapshot of a sorted map, made by ft::map::freeze(). It has the
+// lookup and iteration interface of a const ft::map, but the elements lie in
+// one array in Eytzinger order (see eytzinger), so a search computes its way
+// down instead of following node pointers and loads the cache lines of the
+// next levels ahead of time.
+//
+// It can't be modified, only replaced: freeze the map again and swap or
+// assign the new snapshot over the old one.
+//////////////////////////////////////////////////////////////////////////////
+
+template <class Key, class T, class Compare = std::less<Key>,
+          class Allocator = std::allocator<ft::pair<const Key, T> > >
+class frozen_map {
+ public:
+  //**************************************************
+  // Typedefs
+  //**************************************************
+
+  typedef Key key_type;
+  typedef T mapped_type;
+  typedef ft::pair<const Key, T> value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Compare key_compare;
+  typedef Allocator allocator_type;
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef typename Allocator::pointer pointer;
+  typedef typename Allocator::const_pointer const_pointer;
+
+  typedef eytzinger<value_type, key_compare, allocator_type,
+                    ft::select_first<value_type> >
+      tree_type;
+
+  typedef iterator_eytzinger<const value_type> iterator;  // Read-only
+  typedef iterator_eytzinger<const value_type> const_iterator;
+  typedef ft::reverse_iterator<iterator> reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  frozen_map() : tree_(key_compare(), allocator_type()) {}
+
+  /**
+   * @brief Builds the snapshot from [first;last), which must be sorted by
+   * comp and have no two equal keys, like the elements of a map
+   *
+   * @param first
+   * @param last
+   * @param comp
+   * @param alloc
+   */
+  template <class ForwardIt>
+  frozen_map(ForwardIt first, ForwardIt last, const Compare& comp = Compare(),
+             const Allocator& alloc = Allocator())
+      : tree_(first, distance_(first, last), comp, alloc) {}
+
+  // Same for the count elements from first, which saves counting them
+  template <class ForwardIt>
+  frozen_map(ForwardIt first, size_type count, const Compare& comp = Compare(),
+             const Allocator& alloc = Allocator())
+      : tree_(first, count, comp, alloc) {}
+
+  frozen_map(const frozen_map& other) : tree_(other.tree_) {}
+
+  ~frozen_map() {}
+
+  //**************************************************
+  // Member classes
+  //**************************************************
+
+  class value_compare {
+   public:
+    typedef bool result_type;
+    typedef value_type first_argument_type;
+    typedef value_type second_argument_type;
+
+    value_compare() : comp(key_compare()) {}
+    value_compare(key_compare c) : comp(c) {}
+    bool operator()(const value_type& lhs, const value_type& rhs) const {
+      return comp(lhs.first, rhs.first);
+    }
+
+   protected:
+    key_compare comp;
+  };
+
+  //**************************************************
+  // Operator overloads
+  //**************************************************
+
+  frozen_map& operator=(const frozen_map& other) {
+    tree_ = other.tree_;
+    return *this;
+  }
+
+  //**************************************************
+  // Member functions
+  //**************************************************
+
+  allocator_type get_allocator() const { return tree_.get_allocator(); }
+
+  //**************************************************
+  // Element access
+  //**************************************************
+
+  const mapped_type& at(const Key& key) const {
+    const_iterator ret = find(key);
+    if (ret == end()) throw std::out_of_range("No element with key found");
+    return (*ret).second;
+  }
+
+  //**************************************************
+  // Iterators
+  //**************************************************
+
+  const_iterator begin() const { return tree_.begin(); }
+  const_iterator end() const { return tree_.end(); }
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(end());
+  }
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(begin());
+  }
+
+  //**************************************************
+  // Capacity
+  //**************************************************
+
+  bool empty() const { return (size() == 0); }
+  size_type size() const { return tree_.size(); }
+  size_type max_size() const { return tree_.max_size(); }
+
+  //**************************************************
+  // Modifiers
+  //**************************************************
+
+  void swap(frozen_map& other) { tree_.swap(other.tree_); }
+
+  //**************************************************
+  // Lookup
+  //**************************************************
+
+  size_type count(const Key& key) const { return tree_.find(key) ? 1 : 0; }
+
+  const_iterator find(const Key& key) const {
+    return tree_.iterator_at(tree_.find(key));
+  }
+
+  ft::pair<const_iterator, const_iterator> equal_range(const Key& key) const {
+    return ft::make_pair(lower_bound(key), upper_bound(key));
+  }
+  const_iterator lower_bound(const Key& key) const {
+    return tree_.iterator_at(tree_.lower_bound(key));
+  }
+  const_iterator upper_bound(const Key& key) const {
+    return tree_.iterator_at(tree_.upper_bound(key));
+  }
+
+  //**************************************************
+  // Observers
+  //**************************************************
+
+  key_compare key_comp() const { return tree_.key_comp(); }
+
+  value_compare value_comp() const { return value_compare(tree_.key_comp()); }
+
+ private:
+  template <class ForwardIt>
+  static size_type distance_(ForwardIt first, ForwardIt last) {
+    size_type n = 0;
+    for (; first != last; ++first) ++n;
+    return n;
+  }
+
+  tree_type tree_;
+};
+
+//**************************************************
+// Non-member functions
+//**************************************************
+
+template <class Key, class T, class Compare, class Alloc>
+bool operator==(const ft::frozen_map<Key, T, Compare, Alloc>& lhs,
+                const ft::frozen_map<Key, T, Compare, Alloc>& rhs) {
+  if (lhs.size() != rhs.size()) return false;
+  return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool operator!=(const ft::frozen_map<Key, T, Compare, Alloc>& lhs,
+                const ft::frozen_map<Key, T, Compare, Alloc>& rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace ft
+
+namespace std {
+
+// Specialization of the std::swap function
+template <class Key, class T, class Compare, class Alloc>
+void swap(ft::frozen_map<Key, T, Compare, Alloc>& lhs,
+          ft::frozen_map<Key, T, Compare, Alloc>& rhs) {
+  lhs.swap(rhs);
+}
+
+}  // namespace std
+
+#endif  // FROZEN_MAP_H
@@ -0,0 +1,201 @@
+#ifndef FROZEN_SET_H
+#define FROZEN_SET_H
+
+#include "eytzinger.hpp"
+#include "iterator_eytzinger.hpp"
+#include "static_search_tree.hpp"
+#include "utilities.hpp"
+
+namespace ft {
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::frozen_set
+//
+// Read-only snapshot of a sorted set, made by ft::set::freeze(). Lookup and
+// iteration interface of ft::set on an Eytzinger array, see ft::frozen_map.
+// Integer keys in ascending order go to a static_search_tree instead, whose
+// nodes of 16 keys are compared at once with SIMD: fewer levels to wait for,
+// and iterators that are plain pointers into the sorted keys.
+//////////////////////////////////////////////////////////////////////////////
+
+// Picks the search tree of a frozen_set
+template <class Key, class Compare, class Allocator,
+          bool Integral = ft::is_integral<Key>::value>
+struct frozen_set_tree {
+  typedef eytzinger<Key, Compare, Allocator> type;
+};
+
+template <class Key, class Allocator>
+struct frozen_set_tree<Key, std::less<Key>, Allocator, true> {
+  typedef static_search_tree<Key, std::less<Key>, Allocator> type;
+};
+
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key> >
+class frozen_set {
+ public:
+  //**************************************************
+  // Typedefs
+  //**************************************************
+
+  typedef Key key_type;
+  typedef Key value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Compare key_compare;
+  typedef Compare value_compare;
+  typedef Allocator allocator_type;
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef typename Allocator::pointer pointer;
+  typedef typename Allocator::const_pointer const_pointer;
+
+  typedef typename frozen_set_tree<Key, Compare, Allocator>::type tree_type;
+
+  typedef typename tree_type::const_iterator iterator;  // Key always const
+  typedef typename tree_type::const_iterator const_iterator;
+  typedef ft::reverse_iterator<iterator> reverse_iterator;
+  typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  frozen_set() : tree_(value_compare(), allocator_type()) {}
+
+  /**
+   * @brief Builds the snapshot from [first;last), which must be sorted by
+   * comp and have no two equal keys, like the elements of a set
+   *
+   * @param first
+   * @param last
+   * @param comp
+   * @param alloc
+   */
+  template <class ForwardIt>
+  frozen_set(ForwardIt first, ForwardIt last, const Compare& comp = Compare(),
+             const Allocator& alloc = Allocator())
+      : tree_(first, distance_(first, last), comp, alloc) {}
+
+  // Same for the count elements from first, which saves counting them
+  template <class ForwardIt>
+  frozen_set(ForwardIt first, size_type count, const Compare& comp = Compare(),
+             const Allocator& alloc = Allocator())
+      : tree_(first, count, comp, alloc) {}
+
+  frozen_set(const frozen_set& other) : tree_(other.tree_) {}
+
+  ~frozen_set() {}
+
+  //**************************************************
+  // Operator overloads
+  //**************************************************
+
+  frozen_set& operator=(const frozen_set& other) {
+    tree_ = other.tree_;
+    return *this;
+  }
+
+  //**************************************************
+  // Member functions
+  //**************************************************
+
+  allocator_type get_allocator() const { return tree_.get_allocator(); }
+
+  //**************************************************
+  // Iterators
+  //**************************************************
+
+  iterator begin() const { return tree_.begin(); }
+  iterator end() const { return tree_.end(); }
+  reverse_iterator rbegin() const { return reverse_iterator(end()); }
+  reverse_iterator rend() const { return reverse_iterator(begin()); }
+
+  //**************************************************
+  // Capacity
+  //**************************************************
+
+  bool empty() const { return (size() == 0); }
+  size_type size() const { return tree_.size(); }
+  size_type max_size() const { return tree_.max_size(); }
+
+  //**************************************************
+  // Modifiers
+  //**************************************************
+
+  void swap(frozen_set& other) { tree_.swap(other.tree_); }
+
+  //**************************************************
+  // Lookup
+  //**************************************************
+
+  size_type count(const Key& key) const { return find(key) != end() ? 1 : 0; }
+
+  iterator find(const Key& key) const {
+    return tree_.iterator_at(tree_.find(key));
+  }
+
+  // Keys are unique, so one search is enough
+  ft::pair<iterator, iterator> equal_range(const Key& key) const {
+    iterator first = lower_bound(key);
+    iterator last = first;
+    if (last != end() && !tree_.key_comp()(key, *last)) ++last;
+    return ft::make_pair(first, last);
+  }
+  iterator lower_bound(const Key& key) const {
+    return tree_.iterator_at(tree_.lower_bound(key));
+  }
+  iterator upper_bound(const Key& key) const {
+    return tree_.iterator_at(tree_.upper_bound(key));
+  }
+
+  //**************************************************
+  // Observers
+  //**************************************************
+
+  key_compare key_comp() const { return tree_.key_comp(); }
+
+  value_compare value_comp() const { return tree_.key_comp(); }
+
+ private:
+  template <class ForwardIt>
+  static size_type distance_(ForwardIt first, ForwardIt last) {
+    size_type n = 0;
+    for (; first != last; ++first) ++n;
+    return n;
+  }
+
+  tree_type tree_;
+};
+
+//**************************************************
+// Non-member functions
+//**************************************************
+
+template <class Key, class Compare, class Alloc>
+bool operator==(const ft::frozen_set<Key, Compare, Alloc>& lhs,
+                const ft::frozen_set<Key, Compare, Alloc>& rhs) {
+  if (lhs.size() != rhs.size()) return false;
+  return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class Key, class Compare, class Alloc>
+bool operator!=(const ft::frozen_set<Key, Compare, Alloc>& lhs,
+                const ft::frozen_set<Key, Compare, Alloc>& rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace ft
+
+namespace std {
+
+// Specialization of the std::swap function
+template <class Key, class Compare, class Alloc>
+void swap(ft::frozen_set<Key, Compare, Alloc>& lhs,
+          ft::frozen_set<Key, Compare, Alloc>& rhs) {
+  lhs.swap(rhs);
+}
+
+}  // namespace std
+
+#endif  // FROZEN_SET_H
@@ -0,0 +1,93 @@
+#ifndef GROWTH_POLICY_H
+#define GROWTH_POLICY_H
+
+#include <cstddef>
+#include <limits>
+
+namespace ft {
+
+//////////////////////////////////////////////////////////////////////////////
+// Growth policies for ft::vector
+//
+// When a vector runs out of capacity it asks its policy how far to grow:
+//   static std::size_t next_capacity(std::size_t capacity,
+//                                    std::size_t required,
+//                                    std::size_t object_size);
+// capacity is the current capacity, required the number of objects that must
+// fit and object_size sizeof(value_type). The result may be smaller than
+// required, the vector then allocates exactly required objects. A larger
+// factor means fewer reallocations but more unused memory.
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::growth_factor
+//////////////////////////////////////////////////////////////////////////////
+
+// Multiplies the capacity by Num / Den
+template <std::size_t Num, std::size_t Den>
+struct growth_factor {
+  static std::size_t next_capacity(std::size_t capacity, std::size_t required,
+                                   std::size_t) {
+    const std::size_t max = std::numeric_limits<std::size_t>::max();
+    std::size_t whole = capacity / Den;
+    if (whole > max / Num) return max;
+    std::size_t grown = whole * Num + capacity % Den * Num / Den;
+    return grown < required ? required : grown;
+  }
+};
+
+typedef growth_factor<2, 1> growth_double;
+typedef growth_factor<3, 2> growth_one_and_a_half;
+typedef growth_factor<1618, 1000> growth_golden;
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::growth_page_rounded
+//////////////////////////////////////////////////////////////////////////////
+
+// Grows like Policy, then fills up the last page. Large buffers come straight
+// from mmap, so the rest of the page would be wasted anyway
+template <class Policy = growth_double, std::size_t PageSize = 4096>
+struct growth_page_rounded {
+  static std::size_t next_capacity(std::size_t capacity, std::size_t required,
+                                   std::size_t object_size) {
+    std::size_t grown =
+        Policy::next_capacity(capacity, required, object_size);
+    if (grown > std::numeric_limits<std::size_t>::max() / object_size)
+      return grown;
+    std::size_t bytes = grown * object_size;
+    if (bytes < PageSize) return grown;
+    if (bytes % PageSize) bytes += PageSize - bytes % PageSize;
+    return bytes / object_size;
+  }
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::growth_size_class
+//////////////////////////////////////////////////////////////////////////////
+
+// Grows like Policy, then fills up the size class that jemalloc (and similar
+// allocators) hand out for that many bytes: multiples of 16 up to 128 bytes,
+// above that four classes per power of two
+template <class Policy = growth_double>
+struct growth_size_class {
+  static std::size_t next_capacity(std::size_t capacity, std::size_t required,
+                                   std::size_t object_size) {
+    std::size_t grown =
+        Policy::next_capacity(capacity, required, object_size);
+    if (grown > std::numeric_limits<std::size_t>::max() / 2 / object_size)
+      return grown;
+    std::size_t bytes = grown * object_size;
+    std::size_t spacing = 16;
+    if (bytes > 128) {
+      std::size_t power = 128;
+      while (bytes - power > power) power *= 2;  // power < bytes <= 2 * power
+      spacing = power / 4;
+    }
+    if (bytes % spacing) bytes += spacing - bytes % spacing;
+    return bytes / object_size;
+  }
+};
+
+}  // namespace ft
+
+#endif  // GROWTH_POLICY_H
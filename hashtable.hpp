@@ -0,0 +1,538 @@
+#ifndef HASHTABLE_H
+#define HASHTABLE_H
+
+#include <cstring>
+
+#include "iterator_hashtable.hpp"
+#include "utilities.hpp"
+
+namespace ft {
+
+// An open addressing hash table with linear probing. The values live directly
+// in one array of slots, a second array holds the state of every slot (empty,
+// full or deleted). Erasing leaves a deleted marker (tombstone) behind, so the
+// probe sequences of other values stay intact and no value is ever moved by
+// an erase. Tombstones count towards the load and are dropped by the next
+// rehash.
+//
+// Stores a value_type, KeyOfValue extracts the key that Hash and KeyEqual work
+// on. Lookups take a key, like redblacktree.
+template <class T, class Hash, class KeyEqual,
+          class Allocator = std::allocator<T>,
+          class KeyOfValue = ft::identity<T> >
+class hashtable {
+ public:
+  //**************************************************
+  // Typedefs
+  //**************************************************
+
+  typedef typename KeyOfValue::result_type key_type;
+  typedef T value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Hash hasher;
+  typedef KeyEqual key_equal;
+  typedef Allocator allocator_type;
+
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef typename Allocator::pointer pointer;
+  typedef typename Allocator::const_pointer const_pointer;
+
+  typedef iterator_hash<value_type> iterator;
+  typedef iterator_hash<const value_type> const_iterator;
+
+ private:
+  typedef typename Allocator::template rebind<unsigned char>::other
+      state_allocator;
+
+ public:
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  hashtable(size_type bucket_count, const hasher& hash, const key_equal& equal,
+            const allocator_type& alloc = allocator_type())
+      : allocator_(alloc),
+        hash_(hash),
+        equal_(equal),
+        slots_(NULL),
+        states_(NULL),
+        capacity_(0),
+        seed_(reinterpret_cast<std::size_t>(this)),
+        shift_(0),
+        size_(0),
+        used_(0),
+        limit_(0),
+        first_(0),
+        max_load_factor_(0.5f) {
+    if (bucket_count) rehash(bucket_count);
+  }
+
+  /**
+   * @brief Copy constructor. The copy has the same capacity and every value
+   * stays in its slot, so nothing has to be hashed
+   *
+   * @param other
+   */
+  hashtable(const hashtable& other)
+      : allocator_(other.allocator_),
+        hash_(other.hash_),
+        equal_(other.equal_),
+        slots_(NULL),
+        states_(NULL),
+        capacity_(0),
+        seed_(other.seed_),
+        shift_(0),
+        size_(0),
+        used_(0),
+        limit_(0),
+        first_(0),
+        max_load_factor_(other.max_load_factor_) {
+    if (other.capacity_ == 0) return;
+    allocate_(other.capacity_);
+    std::memcpy(states_, other.states_, capacity_);
+    first_ = other.first_;
+    size_type i = first_;
+    try {
+      for (; i < capacity_; ++i)
+        if (states_[i] == SLOT_FULL)
+          allocator_.construct(slots_ + i, other.slots_[i]);
+    } catch (...) {
+      // Only the slots before i hold objects
+      std::memset(states_ + i, SLOT_EMPTY, capacity_ - i);
+      destroy_all_();
+      deallocate_();
+      throw;
+    }
+    size_ = other.size_;
+    used_ = other.used_;
+  }
+
+  ~hashtable() {
+    destroy_all_();
+    deallocate_();
+  }
+
+  //**************************************************
+  // Operator overloads
+  //**************************************************
+
+  hashtable& operator=(const hashtable& other) {
+    if (this != &other) {
+      hashtable tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  //**************************************************
+  // Iterators
+  //**************************************************
+
+  iterator begin() { return iterator_at(first_full_()); }
+  const_iterator begin() const { return iterator_at(first_full_()); }
+  iterator end() { return iterator_at(capacity_); }
+  const_iterator end() const { return iterator_at(capacity_); }
+
+  iterator iterator_at(size_type index) {
+    return iterator(slots_ + index, states_ + index);
+  }
+  const_iterator iterator_at(size_type index) const {
+    return const_iterator(slots_ + index, states_ + index);
+  }
+
+  // Slot of the value it points to, capacity for end()
+  size_type index_of(const_iterator it) const { return it.base() - slots_; }
+
+  //**************************************************
+  // Capacity
+  //**************************************************
+
+  size_type size() const { return size_; }
+  size_type max_size() const { return allocator_.max_size(); }
+
+  //**************************************************
+  // Modifiers
+  //**************************************************
+
+  /**
+   * @brief Inserts a value if there is none with the same key yet
+   *
+   * @param value
+   * @return ft::pair<size_type, bool> slot of the value with the key and
+   * whether it was inserted
+   */
+  ft::pair<size_type, bool> insert(const value_type& value) {
+    ft::pair<size_type, bool> position = find_position(key_of_(value));
+    if (position.second)
+      return ft::pair<size_type, bool>(position.first, false);
+    return ft::pair<size_type, bool>(insert_at(position.first, value), true);
+  }
+
+  template <class InputIt>
+  void insert_range(InputIt first, InputIt last) {
+    for (; first != last; ++first) insert(*first);
+  }
+
+  /**
+   * @brief Looks for the value with key in a single probe sequence
+   *
+   * @param key
+   * @return ft::pair<size_type, bool> the slot of the value with key and true
+   * if there is one. Otherwise the slot a value with key would go to and false
+   */
+  ft::pair<size_type, bool> find_position(const key_type& key) const {
+    if (capacity_ == 0) return ft::pair<size_type, bool>(0, false);
+    size_type index = home_(hash_(key));
+    size_type tombstone = capacity_;
+    while (true) {
+      unsigned char state = states_[index];
+      if (state == SLOT_EMPTY)
+        return ft::pair<size_type, bool>(
+            tombstone == capacity_ ? index : tombstone, false);
+      if (state == SLOT_FULL) {
+        if (equal_(key_of_(slots_[index]), key))
+          return ft::pair<size_type, bool>(index, true);
+      } else if (tombstone == capacity_) {
+        tombstone = index;
+      }
+      index = (index + 1) & (capacity_ - 1);
+    }
+  }
+
+  /**
+   * @brief Inserts value at a slot without searching for its key again. If the
+   * table has to grow first, the value goes to a new slot
+   *
+   * @param index the slot returned by find_position for the key of value
+   * @param value
+   * @return size_type the slot of the new value
+   */
+  size_type insert_at(size_type index, const value_type& value) {
+    if (capacity_ == 0 ||
+        (states_[index] == SLOT_EMPTY && used_ + 1 > limit_)) {
+      make_room_();
+      index = free_slot_(hash_(key_of_(value)));
+    }
+    allocator_.construct(slots_ + index, value);
+    if (states_[index] == SLOT_EMPTY) ++used_;
+    states_[index] = SLOT_FULL;
+    ++size_;
+    if (index < first_) first_ = index;
+    return index;
+  }
+
+  /**
+   * @brief Erases the value an iterator points to
+   *
+   * @param index a full slot
+   * @return size_type the next full slot, capacity if there is none
+   */
+  size_type erase_at(size_type index) {
+    size_type next = index_of(++iterator_at(index));
+    // Catches first_ up, so erasing from begin() over and over doesn't walk
+    // the slots emptied before again
+    first_ = first_full_();
+    if (first_ == index) first_ = next;
+    destroy_slot_(index);
+    return next;
+  }
+
+  bool erase(const key_type& key) {
+    ft::pair<size_type, bool> position = find_position(key);
+    if (!position.second) return false;
+    destroy_slot_(position.first);
+    return true;
+  }
+
+  void erase(size_type first, size_type last) {
+    while (first != last) first = erase_at(first);
+  }
+
+  /**
+   * @brief Destroys all values, the capacity stays
+   *
+   */
+  void clear() {
+    if (capacity_ == 0) return;
+    destroy_all_();
+    std::memset(states_, SLOT_EMPTY, capacity_);
+    size_ = 0;
+    used_ = 0;
+    first_ = capacity_;
+  }
+
+  void swap(hashtable& other) {
+    std::swap(allocator_, other.allocator_);
+    std::swap(hash_, other.hash_);
+    std::swap(equal_, other.equal_);
+    std::swap(slots_, other.slots_);
+    std::swap(states_, other.states_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(seed_, other.seed_);
+    std::swap(shift_, other.shift_);
+    std::swap(size_, other.size_);
+    std::swap(used_, other.used_);
+    std::swap(limit_, other.limit_);
+    std::swap(first_, other.first_);
+    std::swap(max_load_factor_, other.max_load_factor_);
+  }
+
+  //**************************************************
+  // Lookup
+  //**************************************************
+
+  // Slot of the value with key, capacity if there is none
+  size_type find(const key_type& key) const {
+    ft::pair<size_type, bool> position = find_position(key);
+    return position.second ? position.first : capacity_;
+  }
+
+  //**************************************************
+  // Hash policy
+  //**************************************************
+
+  size_type bucket_count() const { return capacity_; }
+
+  float load_factor() const {
+    return capacity_ ? static_cast<float>(size_) / capacity_ : 0.0f;
+  }
+
+  float max_load_factor() const { return max_load_factor_; }
+
+  /**
+   * @brief Sets the load (values and tombstones per slot) at which the table
+   * grows. Kept in (0; 0.95], a probe sequence needs an empty slot to end
+   *
+   * @param ml
+   */
+  void max_load_factor(float ml) {
+    if (!(ml > 0.0f)) ml = 0.5f;
+    if (ml > 0.95f) ml = 0.95f;
+    max_load_factor_ = ml;
+    if (capacity_ == 0) return;
+    limit_ = limit_for_(capacity_);
+    if (used_ > limit_) rehash_to_(capacity_for_(size_));
+  }
+
+  /**
+   * @brief Rebuilds the table with at least count slots, and at least as many
+   * as the values need. Drops all tombstones
+   *
+   * @param count
+   */
+  void rehash(size_type count) {
+    size_type capacity = capacity_for_(size_);
+    while (capacity < count) {
+      if (capacity > max_size() / 2)
+        throw std::length_error("rehash count exceeded max_size()");
+      capacity *= 2;
+    }
+    rehash_to_(capacity);
+  }
+
+  /**
+   * @brief Makes room for count values, so inserting them doesn't rehash
+   *
+   * @param count
+   */
+  void reserve(size_type count) {
+    size_type capacity = capacity_for_(count);
+    if (capacity > capacity_) rehash_to_(capacity);
+  }
+
+  //**************************************************
+  // Observers
+  //**************************************************
+
+  hasher hash_function() const { return hash_; }
+  key_equal key_eq() const { return equal_; }
+  allocator_type get_allocator() const { return allocator_; }
+
+ private:
+  //**************************************************
+  // Member objects
+  //**************************************************
+
+  allocator_type allocator_;
+  hasher hash_;
+  key_equal equal_;
+  pointer slots_;
+  unsigned char* states_;  // capacity_ + 1 entries, the last one SLOT_END
+  size_type capacity_;     // 0 or a power of two
+  std::size_t seed_;       // mixed into every hash, see home_()
+  unsigned shift_;         // bits of size_t minus log2(capacity_)
+  size_type size_;         // full slots
+  size_type used_;         // full and deleted slots
+  size_type limit_;        // used_ at which the table grows
+  size_type first_;        // at or before the first full slot
+  float max_load_factor_;
+
+  //**************************************************
+  // Private member functions
+  //**************************************************
+
+  static size_type min_capacity_() { return 8; }
+
+  /**
+   * @brief Picks the slot a probe for hash starts at. The hash is mixed with
+   * the seed of the table and two rounds of Fibonacci hashing (multiplying
+   * with 2^N / golden ratio), the top bits of the result are the slot.
+   *
+   * Integers are their own hash, so without mixing neighbouring keys would
+   * pile up in neighbouring slots. Without the seed every table would order
+   * the values the same way: inserting one table into a smaller one in
+   * iteration order would fill the slots front to back, one long cluster
+   *
+   * @param hash
+   * @return size_type
+   */
+  size_type home_(std::size_t hash) const {
+    const std::size_t golden =
+        sizeof(std::size_t) > 4
+            ? (static_cast<std::size_t>(0x9E3779B9U) << 16 << 16) | 0x7F4A7C15U
+            : static_cast<std::size_t>(0x9E3779B9U);
+    hash = (hash ^ seed_) * golden;
+    hash = (hash ^ (hash >> (std::numeric_limits<std::size_t>::digits / 2))) *
+           golden;
+    return hash >> shift_;
+  }
+
+  size_type limit_for_(size_type capacity) const {
+    size_type limit = static_cast<size_type>(capacity * max_load_factor_);
+    return limit < capacity ? limit : capacity - 1;
+  }
+
+  // Smallest capacity that holds count values without growing
+  size_type capacity_for_(size_type count) const {
+    size_type capacity = min_capacity_();
+    while (limit_for_(capacity) < count) {
+      if (capacity > max_size() / 2)
+        throw std::length_error("count of values exceeded max_size()");
+      capacity *= 2;
+    }
+    return capacity;
+  }
+
+  // The first full slot, capacity_ if there is none. Only inserts move first_
+  // back, an erase by key leaves it behind, so begin() skips forward from it
+  size_type first_full_() const {
+    if (size_ == 0) return capacity_;
+    const_iterator it = iterator_at(first_);
+    if (states_[first_] != SLOT_FULL) ++it;
+    return index_of(it);
+  }
+
+  /**
+   * @brief Destroys the value in a slot. Its slot becomes a tombstone, unless
+   * no probe sequence runs through it
+   *
+   * @param index a full slot
+   */
+  void destroy_slot_(size_type index) {
+    allocator_.destroy(slots_ + index);
+    --size_;
+    size_type mask = capacity_ - 1;
+    if (states_[(index + 1) & mask] == SLOT_EMPTY) {
+      // Probes stop at an empty slot, the tombstones directly in front of it
+      // are never passed and can go as well
+      states_[index] = SLOT_EMPTY;
+      --used_;
+      for (size_type prev = (index - 1) & mask; states_[prev] == SLOT_DELETED;
+           prev = (prev - 1) & mask) {
+        states_[prev] = SLOT_EMPTY;
+        --used_;
+      }
+    } else {
+      states_[index] = SLOT_DELETED;
+    }
+  }
+
+  // First free slot of the probe sequence of hash, for keys known to be absent
+  size_type free_slot_(std::size_t hash) const {
+    size_type index = home_(hash);
+    while (states_[index] == SLOT_FULL) index = (index + 1) & (capacity_ - 1);
+    return index;
+  }
+
+  // Called when one more value doesn't fit. If the values themselves are
+  // below half the limit, it's the tombstones that fill the table, and a
+  // rehash at the same capacity drops them. Otherwise the table doubles
+  void make_room_() {
+    size_type capacity = capacity_for_(size_ + 1);
+    if (capacity <= capacity_)
+      capacity = 2 * (size_ + 1) > limit_ ? 2 * capacity_ : capacity_;
+    rehash_to_(capacity);
+  }
+
+  /**
+   * @brief Moves all values into a new table of capacity slots. If a value
+   * can't be moved (or copied) the old table is left as it was
+   *
+   * @param capacity a power of two, big enough for all values
+   */
+  void rehash_to_(size_type capacity) {
+    hashtable tmp(0, hash_, equal_, allocator_);
+    tmp.seed_ = seed_;
+    tmp.max_load_factor_ = max_load_factor_;
+    tmp.allocate_(capacity);
+    std::memset(tmp.states_, SLOT_EMPTY, capacity);
+    for (size_type i = first_; i < capacity_; ++i) {
+      if (states_[i] != SLOT_FULL) continue;
+      size_type index = tmp.free_slot_(hash_(key_of_(slots_[i])));
+      tmp.allocator_.construct(tmp.slots_ + index,
+                               ft::move_if_noexcept(slots_[i]));
+      tmp.states_[index] = SLOT_FULL;
+      ++tmp.size_;
+      if (index < tmp.first_) tmp.first_ = index;
+    }
+    tmp.used_ = tmp.size_;
+    swap(tmp);
+  }
+
+  // Allocates capacity slots without values, first_ is set to the end
+  void allocate_(size_type capacity) {
+    state_allocator state_alloc(allocator_);
+    unsigned char* states = state_alloc.allocate(capacity + 1);
+    try {
+      slots_ = allocator_.allocate(capacity);
+    } catch (...) {
+      state_alloc.deallocate(states, capacity + 1);
+      throw;
+    }
+    states_ = states;
+    states_[capacity] = SLOT_END;
+    capacity_ = capacity;
+    shift_ = std::numeric_limits<std::size_t>::digits;
+    while (capacity > 1) {
+      capacity >>= 1;
+      --shift_;
+    }
+    limit_ = limit_for_(capacity_);
+    first_ = capacity_;
+  }
+
+  void deallocate_() {
+    if (capacity_ == 0) return;
+    allocator_.deallocate(slots_, capacity_);
+    state_allocator(allocator_).deallocate(states_, capacity_ + 1);
+    slots_ = NULL;
+    states_ = NULL;
+    capacity_ = 0;
+    first_ = 0;
+  }
+
+  void destroy_all_() {
+    for (size_type i = first_; i < capacity_; ++i)
+      if (states_[i] == SLOT_FULL) allocator_.destroy(slots_ + i);
+  }
+
+  const key_type& key_of_(const value_type& value) const {
+    return KeyOfValue()(value);
+  }
+};
+
+}  // namespace ft
+
+#endif  // HASHTABLE_H
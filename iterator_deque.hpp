@@ -0,0 +1,226 @@
+#ifndef ITERATOR_DEQUE_H
+#define ITERATOR_DEQUE_H
+
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include "utilities.hpp"
+
+namespace ft {
+
+template <class T, class Allocator>
+class deque;
+
+// Objects per block of a deque: 4 kB worth, but at least 16
+inline std::ptrdiff_t deque_block_size(std::size_t object_size) {
+  return object_size <= 256 ? 4096 / object_size : 16;
+}
+
+//**************************************************
+// This is a random access iterator
+//
+// It points at an object in one of the deque's blocks. node_ is the entry of
+// that block in the deque's map, [first_;last_) is the block itself.
+// block_pointer is the non-const pointer type the map holds
+//**************************************************
+template <class datatype, class block_pointer>
+class Iterator_deque {
+ public:
+  typedef std::random_access_iterator_tag iterator_category;
+  typedef datatype value_type;
+  typedef datatype* pointer;
+  typedef datatype& reference;
+  typedef std::ptrdiff_t difference_type;
+
+  //**************************************************
+  // Constructor
+  //**************************************************
+  Iterator_deque() : cur_(NULL), first_(NULL), last_(NULL), node_(NULL) {}
+  Iterator_deque(pointer cur, block_pointer* node)
+      : cur_(cur), first_(*node), last_(*node + block_size()), node_(node) {}
+  Iterator_deque(const Iterator_deque& other)
+      : cur_(other.cur_),
+        first_(other.first_),
+        last_(other.last_),
+        node_(other.node_) {}
+  ~Iterator_deque() {}
+
+  //**************************************************
+  // Operator overloads
+  //**************************************************
+  Iterator_deque& operator=(const Iterator_deque& other) {
+    cur_ = other.cur_;
+    first_ = other.first_;
+    last_ = other.last_;
+    node_ = other.node_;
+    return *this;
+  }
+
+  reference operator*() const { return *cur_; }
+  pointer operator->() const { return cur_; }
+
+  Iterator_deque& operator++() {
+    ++cur_;
+    if (cur_ == last_) {
+      set_node_(node_ + 1);
+      cur_ = first_;
+    }
+    return *this;
+  }
+  Iterator_deque operator++(int) {
+    Iterator_deque tmp(*this);
+    ++*this;
+    return tmp;
+  }
+  Iterator_deque& operator--() {
+    if (cur_ == first_) {
+      set_node_(node_ - 1);
+      cur_ = last_;
+    }
+    --cur_;
+    return *this;
+  }
+  Iterator_deque operator--(int) {
+    Iterator_deque tmp(*this);
+    --*this;
+    return tmp;
+  }
+  Iterator_deque& operator+=(difference_type n) {
+    difference_type offset = n + (cur_ - first_);
+    if (offset >= 0 && offset < block_size()) {
+      cur_ += n;
+    } else {
+      difference_type node_offset =
+          offset > 0 ? offset / block_size()
+                     : -((-offset - 1) / block_size()) - 1;
+      set_node_(node_ + node_offset);
+      cur_ = first_ + (offset - node_offset * block_size());
+    }
+    return *this;
+  }
+  Iterator_deque operator+(difference_type n) const {
+    Iterator_deque tmp(*this);
+    tmp += n;
+    return tmp;
+  }
+  Iterator_deque& operator-=(difference_type n) { return *this += -n; }
+  Iterator_deque operator-(difference_type n) const {
+    Iterator_deque tmp(*this);
+    tmp += -n;
+    return tmp;
+  }
+  difference_type operator-(const Iterator_deque& other) const {
+    if (node_ == other.node_) return cur_ - other.cur_;
+    return block_size() * (node_ - other.node_ - 1) + (cur_ - first_) +
+           (other.last_ - other.cur_);
+  }
+  reference operator[](difference_type n) const { return *(*this + n); }
+  bool operator<(const Iterator_deque& other) const {
+    return node_ == other.node_ ? cur_ < other.cur_ : node_ < other.node_;
+  }
+  bool operator>(const Iterator_deque& other) const { return other < *this; }
+  bool operator<=(const Iterator_deque& other) const {
+    return !(other < *this);
+  }
+  bool operator>=(const Iterator_deque& other) const {
+    return !(*this < other);
+  }
+  bool operator==(const Iterator_deque& other) const {
+    return this->cur_ == other.cur_;
+  }
+  bool operator!=(const Iterator_deque& other) const {
+    return this->cur_ != other.cur_;
+  }
+
+  //**************************************************
+  // Functions
+  //**************************************************
+  pointer base() const { return cur_; }
+
+  static difference_type block_size() {
+    return deque_block_size(sizeof(datatype));
+  }
+
+  //**************************************************
+  // Conversion overloads
+  //**************************************************
+
+  // Implicit conversion to const_iterator (e.g. when making const iterator of
+  // non-const deque)
+  operator Iterator_deque<const value_type, block_pointer>() const {
+    Iterator_deque<const value_type, block_pointer> tmp;
+    tmp.cur_ = cur_;
+    tmp.first_ = first_;
+    tmp.last_ = last_;
+    tmp.node_ = node_;
+    return tmp;
+  }
+
+ protected:
+  template <class, class>
+  friend class Iterator_deque;
+  template <class, class>
+  friend class deque;
+
+  // Moves to another block, cur_ is left to the caller
+  void set_node_(block_pointer* node) {
+    node_ = node;
+    first_ = *node;
+    last_ = first_ + block_size();
+  }
+
+  pointer cur_;
+  pointer first_;
+  pointer last_;
+  block_pointer* node_;
+};
+
+//**************************************************
+// Non-member operator overloads
+//**************************************************
+
+template <class T, class B>
+Iterator_deque<T, B> operator+(typename Iterator_deque<T, B>::difference_type n,
+                               const Iterator_deque<T, B>& it) {
+  return it + n;
+}
+
+template <class T, class B>
+typename Iterator_deque<T, B>::difference_type operator-(
+    const Iterator_deque<T, B>& lhs, const Iterator_deque<const T, B>& rhs) {
+  return Iterator_deque<const T, B>(lhs) - rhs;
+}
+
+template <class T, class B>
+bool operator!=(Iterator_deque<T, B> lhs, Iterator_deque<const T, B> rhs) {
+  return (lhs.base() != rhs.base());
+}
+
+template <class T, class B>
+bool operator==(Iterator_deque<T, B> lhs, Iterator_deque<const T, B> rhs) {
+  return (lhs.base() == rhs.base());
+}
+
+template <class T, class B>
+bool operator<(Iterator_deque<T, B> lhs, Iterator_deque<const T, B> rhs) {
+  return Iterator_deque<const T, B>(lhs) < rhs;
+}
+
+template <class T, class B>
+bool operator<=(Iterator_deque<T, B> lhs, Iterator_deque<const T, B> rhs) {
+  return Iterator_deque<const T, B>(lhs) <= rhs;
+}
+
+template <class T, class B>
+bool operator>(Iterator_deque<T, B> lhs, Iterator_deque<const T, B> rhs) {
+  return Iterator_deque<const T, B>(lhs) > rhs;
+}
+
+template <class T, class B>
+bool operator>=(Iterator_deque<T, B> lhs, Iterator_deque<const T, B> rhs) {
+  return Iterator_deque<const T, B>(lhs) >= rhs;
+}
+
+}  // namespace ft
+
+#endif  // ITERATOR_DEQUE_H
@@ -0,0 +1,150 @@
+#ifndef ITERATOR_EYTZINGER_H
+#define ITERATOR_EYTZINGER_H
+
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include "utilities.hpp"
+
+namespace ft {
+
+//**************************************************
+// This is a bidirectional iterator
+//
+// It walks an array in Eytzinger order (see eytzinger) in key order. The
+// children of index k are 2k and 2k + 1, the array starts at index 1 and
+// index 0 is end()
+//**************************************************
+template <class datatype>
+class iterator_eytzinger {
+ public:
+  typedef std::bidirectional_iterator_tag iterator_category;
+  typedef datatype value_type;
+  typedef datatype* pointer;
+  typedef datatype& reference;
+  typedef std::ptrdiff_t difference_type;
+
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  iterator_eytzinger() : values_(NULL), index_(0), size_(0) {}
+  iterator_eytzinger(pointer values, std::size_t index, std::size_t size)
+      : values_(values), index_(index), size_(size) {}
+  iterator_eytzinger(const iterator_eytzinger& other)
+      : values_(other.values_), index_(other.index_), size_(other.size_) {}
+  ~iterator_eytzinger() {}
+
+  //**************************************************
+  // Operator overloads
+  //**************************************************
+
+  iterator_eytzinger& operator=(const iterator_eytzinger& other) {
+    values_ = other.values_;
+    index_ = other.index_;
+    size_ = other.size_;
+    return *this;
+  }
+
+  reference operator*() const { return values_[index_]; }
+  pointer operator->() const { return values_ + index_; }
+
+  iterator_eytzinger& operator++() {
+    inorder_successor_();
+    return *this;
+  }
+  iterator_eytzinger operator++(int) {
+    iterator_eytzinger tmp(*this);
+    inorder_successor_();
+    return tmp;
+  }
+  iterator_eytzinger& operator--() {
+    inorder_predecessor_();
+    return *this;
+  }
+  iterator_eytzinger operator--(int) {
+    iterator_eytzinger tmp(*this);
+    inorder_predecessor_();
+    return tmp;
+  }
+
+  bool operator==(const iterator_eytzinger& other) const {
+    return index_ == other.index_ && values_ == other.values_;
+  }
+  bool operator!=(const iterator_eytzinger& other) const {
+    return !(*this == other);
+  }
+
+  //**************************************************
+  // Functions
+  //**************************************************
+
+  pointer base() const { return values_; }
+  std::size_t index() const { return index_; }
+
+  //**************************************************
+  // Conversion overloads
+  //**************************************************
+
+  // Implicit conversion to const_iterator
+  operator iterator_eytzinger<const value_type>() const {
+    return iterator_eytzinger<const value_type>(values_, index_, size_);
+  }
+
+ protected:
+  pointer values_;
+  std::size_t index_;
+  std::size_t size_;
+
+ private:
+  // Leftmost index below the right child, or up to the first ancestor whose
+  // left subtree we come from. From the last index that is 0, end()
+  void inorder_successor_() {
+    if (index_ == 0) {
+      index_ = size_ ? 1 : 0;
+      while (index_ && 2 * index_ <= size_) index_ *= 2;
+      return;
+    }
+    if (2 * index_ + 1 <= size_) {
+      index_ = 2 * index_ + 1;
+      while (2 * index_ <= size_) index_ *= 2;
+    } else {
+      while (index_ & 1) index_ >>= 1;
+      index_ >>= 1;
+    }
+  }
+
+  // Mirror image of inorder_successor_, end() goes to the last index
+  void inorder_predecessor_() {
+    if (index_ == 0) {
+      index_ = size_ ? 1 : 0;
+      while (index_ && 2 * index_ + 1 <= size_) index_ = 2 * index_ + 1;
+      return;
+    }
+    if (2 * index_ <= size_) {
+      index_ = 2 * index_;
+      while (2 * index_ + 1 <= size_) index_ = 2 * index_ + 1;
+    } else {
+      while (index_ && !(index_ & 1)) index_ >>= 1;
+      index_ >>= 1;
+    }
+  }
+};
+
+//**************************************************
+// Non-member operator overloads
+//**************************************************
+
+template <class T>
+bool operator==(iterator_eytzinger<T> lhs, iterator_eytzinger<const T> rhs) {
+  return lhs.index() == rhs.index() && lhs.base() == rhs.base();
+}
+
+template <class T>
+bool operator!=(iterator_eytzinger<T> lhs, iterator_eytzinger<const T> rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace ft
+
+#endif  // ITERATOR_EYTZINGER_H
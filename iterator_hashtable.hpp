@@ -0,0 +1,123 @@
+#ifndef ITERATOR_HASHTABLE_H
+#define ITERATOR_HASHTABLE_H
+
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include "utilities.hpp"
+
+namespace ft {
+
+// State (control byte) of a slot of a hash table. Every byte below
+// SLOT_EMPTY means full: hashtable uses SLOT_FULL, swisstable keeps 7 bits of
+// the hash there
+enum slot_state {
+  SLOT_FULL = 0x00,
+  SLOT_EMPTY = 0x80,
+  SLOT_DELETED = 0xFE,
+  SLOT_END = 0xFF
+};
+
+// True for the slots an iterator stops at
+inline bool slot_is_full_or_end(unsigned char state) {
+  return state < SLOT_EMPTY || state == SLOT_END;
+}
+
+//**************************************************
+// This is a forward iterator
+//
+// It walks the slots of a hash table and skips those without a value. The
+// state array has a SLOT_END entry behind the last slot, so the walk stops at
+// end() without checking the bounds
+//**************************************************
+template <class datatype>
+class iterator_hash {
+ public:
+  typedef std::forward_iterator_tag iterator_category;
+  typedef datatype value_type;
+  typedef datatype* pointer;
+  typedef datatype& reference;
+  typedef std::ptrdiff_t difference_type;
+
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  iterator_hash() : slot_(NULL), state_(NULL) {}
+  iterator_hash(pointer slot, const unsigned char* state)
+      : slot_(slot), state_(state) {}
+  iterator_hash(const iterator_hash& other)
+      : slot_(other.slot_), state_(other.state_) {}
+  ~iterator_hash() {}
+
+  //**************************************************
+  // Operator overloads
+  //**************************************************
+
+  iterator_hash& operator=(const iterator_hash& other) {
+    slot_ = other.slot_;
+    state_ = other.state_;
+    return *this;
+  }
+
+  reference operator*() const { return *slot_; }
+  pointer operator->() const { return slot_; }
+
+  iterator_hash& operator++() {
+    do {
+      ++slot_;
+      ++state_;
+    } while (!slot_is_full_or_end(*state_));
+    return *this;
+  }
+  iterator_hash operator++(int) {
+    iterator_hash tmp(*this);
+    ++*this;
+    return tmp;
+  }
+
+  bool operator==(const iterator_hash& other) const {
+    return slot_ == other.slot_;
+  }
+  bool operator!=(const iterator_hash& other) const {
+    return slot_ != other.slot_;
+  }
+
+  //**************************************************
+  // Functions
+  //**************************************************
+
+  pointer base() const { return slot_; }
+
+  //**************************************************
+  // Conversion overloads
+  //**************************************************
+
+  // Implicit conversion to const_iterator (e.g. when making const iterator of
+  // non-const unordered_map)
+  operator iterator_hash<const value_type>() const {
+    return iterator_hash<const value_type>(slot_, state_);
+  }
+
+ protected:
+  pointer slot_;
+  const unsigned char* state_;
+};
+
+//**************************************************
+// Non-member operator overloads
+//**************************************************
+
+template <class T>
+bool operator==(iterator_hash<T> lhs, iterator_hash<const T> rhs) {
+  return lhs.base() == rhs.base();
+}
+
+template <class T>
+bool operator!=(iterator_hash<T> lhs, iterator_hash<const T> rhs) {
+  return lhs.base() != rhs.base();
+}
+
+}  // namespace ft
+
+#endif  // ITERATOR_HASHTABLE_H
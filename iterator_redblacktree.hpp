@@ -76,6 +76,8 @@ class iterator_rbt {
 
   pointer base() const { return &(node_->data); }
 
+  node_type *node() const { return node_; }
+
   //**************************************************
   // Conversion overloads
   //**************************************************
@@ -91,37 +93,37 @@ class iterator_rbt {
 
  private:
   void inorder_successor_() {
-    if (node_->is_null_node) {
-      node_ = min_value_(node_->parent);
+    if (node_->is_off_the_end()) {
+      node_ = min_value_(node_->parent());
       return;
     }
-    if (!node_->right_child->is_null_node)
+    if (!node_->right_child->is_off_the_end())
       node_ = min_value_(node_->right_child);
     else {
-      node_type *parent = node_->parent;
-      while (!parent->is_null_node && node_ == parent->right_child) {
+      node_type *parent = node_->parent();
+      while (!parent->is_off_the_end() && node_ == parent->right_child) {
         node_ = parent;
-        parent = node_->parent;
+        parent = node_->parent();
       }
       node_ = parent;
     }
   }
 
   void inorder_predecessor_() {
-    // The only null node is the off_the_end_ node which parent is last_
-    if (node_->is_null_node) {
-      node_ = node_->parent;
+    // The only node without a value is off_the_end, its parent is last_
+    if (node_->is_off_the_end()) {
+      node_ = node_->parent();
       return;
     }
-    if (!node_->left_child->is_null_node)
+    if (!node_->left_child->is_off_the_end())
       node_ = max_value_(node_->left_child);
     else {
-      node_type *parent = node_->parent;
-      while (!parent->is_null_node && node_ == parent->left_child) {
+      node_type *parent = node_->parent();
+      while (!parent->is_off_the_end() && node_ == parent->left_child) {
         node_ = parent;
-        parent = node_->parent;
+        parent = node_->parent();
       }
-      if (parent->is_null_node) {
+      if (parent->is_off_the_end()) {
         node_ = NULL;
         return;
       }
@@ -137,7 +139,8 @@ class iterator_rbt {
    */
   node_type *min_value_(node_type *node) const {
     node_type *current = node;
-    while (!current->left_child->is_null_node) current = current->left_child;
+    while (!current->left_child->is_off_the_end())
+      current = current->left_child;
     return current;
   }
 
@@ -149,7 +152,8 @@ class iterator_rbt {
    */
   node_type *max_value_(node_type *node) const {
     node_type *current = node;
-    while (!current->right_child->is_null_node) current = current->right_child;
+    while (!current->right_child->is_off_the_end())
+      current = current->right_child;
     return current;
   }
 };
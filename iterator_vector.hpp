@@ -31,6 +31,11 @@ class Iterator_vector {
   //**************************************************
   // Operator overloads
   //**************************************************
+  Iterator_vector& operator=(const Iterator_vector& other) {
+    data_ = other.data_;
+    return *this;
+  }
+
   reference operator*() const { return *data_; }
 
   Iterator_vector& operator++() {
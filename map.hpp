@@ -7,6 +7,10 @@
 
 namespace ft {
 
+// Defined in frozen_map.hpp, which only callers of map::freeze() include
+template <class Key, class T, class Compare, class Allocator>
+class frozen_map;
+
 template <class Key, class T, class Compare = std::less<Key>,
           class Allocator = std::allocator<ft::pair<const Key, T> > >
 class map {
@@ -27,8 +31,9 @@ class map {
   typedef typename Allocator::pointer pointer;
   typedef typename Allocator::const_pointer const_pointer;
 
-  class value_compare;
-  typedef redblacktree<value_type, value_compare, allocator_type> tree_type;
+  typedef redblacktree<value_type, key_compare, allocator_type,
+                       ft::select_first<value_type> >
+      tree_type;
 
   typedef iterator_rbt<value_type, rb_node<value_type> > iterator;
   typedef iterator_rbt<const value_type, rb_node<value_type> > const_iterator;
@@ -39,7 +44,7 @@ class map {
   // Constructors
   //**************************************************
 
-  map() : tree_(value_compare(), allocator_type()) {}
+  map() : tree_(key_compare(), allocator_type()) {}
 
   explicit map(const Compare& comp, const Allocator& alloc = Allocator())
       : tree_(comp, alloc) {}
@@ -59,8 +64,7 @@ class map {
   // Member classes
   //**************************************************
 
-  class value_compare
-      : public std::binary_function<value_type, value_type, bool> {
+  class value_compare {
    public:
     typedef bool result_type;
     typedef value_type first_argument_type;
@@ -108,11 +112,7 @@ class map {
   }
 
   mapped_type& operator[](const Key& key) {
-    iterator ret = find(key);
-    if (ret == end())
-      return (*(insert(value_type(key, mapped_type())).first)).second;
-    else
-      return (*ret).second;
+    return (*try_emplace(key).first).second;
   }
 
   //**************************************************
@@ -151,24 +151,82 @@ class map {
     return ft::pair<iterator, bool>(iterator(tmp.first), tmp.second);
   }
 
+  /**
+   * @brief Inserts a value-initialized element with key if there is none yet.
+   * The tree is searched once and the element is only built if it is missing
+   *
+   * @param key
+   * @return ft::pair<iterator, bool> iterator to the element with key and
+   * whether it was inserted
+   */
+  ft::pair<iterator, bool> try_emplace(const key_type& key) {
+    ft::pair<typename tree_type::node_type*, bool> position =
+        tree_.find_position(key);
+    if (position.second)
+      return ft::pair<iterator, bool>(iterator(position.first), false);
+    return ft::pair<iterator, bool>(
+        iterator(tree_.insert_at(position.first,
+                                 value_type(key, mapped_type()))),
+        true);
+  }
+
+  /**
+   * @brief Inserts (key, obj) if there is no element with key yet. obj is only
+   * copied if the element is inserted
+   *
+   * @param key
+   * @param obj
+   * @return ft::pair<iterator, bool> iterator to the element with key and
+   * whether it was inserted
+   */
+  ft::pair<iterator, bool> try_emplace(const key_type& key,
+                                       const mapped_type& obj) {
+    ft::pair<typename tree_type::node_type*, bool> position =
+        tree_.find_position(key);
+    if (position.second)
+      return ft::pair<iterator, bool>(iterator(position.first), false);
+    return ft::pair<iterator, bool>(
+        iterator(tree_.insert_at(position.first, value_type(key, obj))), true);
+  }
+
+  /**
+   * @brief Assigns obj to the element with key, or inserts (key, obj) if there
+   * is none. The tree is searched once
+   *
+   * @param key
+   * @param obj
+   * @return ft::pair<iterator, bool> iterator to the element with key and
+   * whether it was inserted
+   */
+  ft::pair<iterator, bool> insert_or_assign(const key_type& key,
+                                            const mapped_type& obj) {
+    ft::pair<typename tree_type::node_type*, bool> position =
+        tree_.find_position(key);
+    if (position.second) {
+      position.first->data.second = obj;
+      return ft::pair<iterator, bool>(iterator(position.first), false);
+    }
+    return ft::pair<iterator, bool>(
+        iterator(tree_.insert_at(position.first, value_type(key, obj))), true);
+  }
+
   iterator insert(iterator pos, const value_type& value) {
-    (void)pos;
-    return iterator(tree_.insert(value).first);
+    return iterator(tree_.insert(pos.node(), value).first);
   }
 
   template <class InputIt>
   void insert(InputIt first, InputIt last) {
-    while (first != last) tree_.insert(*(first++));
+    tree_.insert_range(first, last);
   }
 
-  void erase(iterator pos) { tree_.erase(*pos); }
+  void erase(iterator pos) { tree_.erase(pos.node()); }
 
   void erase(iterator first, iterator last) {
-    while (first != last) tree_.erase(*(first++));
+    tree_.erase(first.node(), last.node());
   }
 
   size_type erase(const Key& key) {
-    bool erased = tree_.erase(value_type(key, mapped_type()));
+    bool erased = tree_.erase(key);
     return erased;
   }
 
@@ -179,19 +237,14 @@ class map {
   //**************************************************
 
   size_type count(const Key& key) const {
-    (void)key;
-    iterator it1(tree_.find(value_type(key, mapped_type())));
-    iterator it2(tree_.get_end());
-    if (it1 == it2) return 0;
+    if (tree_.find(key) == tree_.get_end()) return 0;
     return 1;
   }
 
-  iterator find(const Key& key) {
-    return iterator(tree_.find(value_type(key, mapped_type())));
-  }
+  iterator find(const Key& key) { return iterator(tree_.find(key)); }
 
   const_iterator find(const Key& key) const {
-    return const_iterator(tree_.find(value_type(key, mapped_type())));
+    return const_iterator(tree_.find(key));
   }
 
   ft::pair<iterator, iterator> equal_range(const Key& key) {
@@ -201,25 +254,103 @@ class map {
     return ft::make_pair(lower_bound(key), upper_bound(key));
   }
   iterator lower_bound(const Key& key) {
-    return iterator(tree_.lower_bound(value_type(key, mapped_type())));
+    return iterator(tree_.lower_bound(key));
   }
   const_iterator lower_bound(const Key& key) const {
-    return const_iterator(tree_.lower_bound(value_type(key, mapped_type())));
+    return const_iterator(tree_.lower_bound(key));
   }
   iterator upper_bound(const Key& key) {
-    return iterator(tree_.upper_bound(value_type(key, mapped_type())));
+    return iterator(tree_.upper_bound(key));
   }
   const_iterator upper_bound(const Key& key) const {
-    return const_iterator(tree_.upper_bound(value_type(key, mapped_type())));
+    return const_iterator(tree_.upper_bound(key));
+  }
+
+  /**
+   * @brief writes find(key) to out for every key in [first;last). The
+   * searches of several keys are interleaved, so their cache misses overlap
+   *
+   * @param first
+   * @param last
+   * @param out receives one iterator per key
+   * @return OutputIt out past the last written iterator
+   */
+  template <class ForwardIt, class OutputIt>
+  OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) {
+    return tree_.template find_batch<iterator>(first, last, out);
+  }
+  template <class ForwardIt, class OutputIt>
+  OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const {
+    return tree_.template find_batch<const_iterator>(first, last, out);
+  }
+
+  /**
+   * @brief writes lower_bound(key) to out for every key in [first;last), see
+   * find_batch
+   */
+  template <class ForwardIt, class OutputIt>
+  OutputIt lower_bound_batch(ForwardIt first, ForwardIt last, OutputIt out) {
+    return tree_.template lower_bound_batch<iterator>(first, last, out);
+  }
+  template <class ForwardIt, class OutputIt>
+  OutputIt lower_bound_batch(ForwardIt first, ForwardIt last,
+                             OutputIt out) const {
+    return tree_.template lower_bound_batch<const_iterator>(first, last, out);
+  }
+
+  /**
+   * @brief find_batch for keys in ascending order. Every search starts at the
+   * result of the previous key, so close keys skip the upper tree levels
+   */
+  template <class ForwardIt, class OutputIt>
+  OutputIt find_batch_sorted(ForwardIt first, ForwardIt last, OutputIt out) {
+    return tree_.template find_batch_sorted<iterator>(first, last, out);
+  }
+  template <class ForwardIt, class OutputIt>
+  OutputIt find_batch_sorted(ForwardIt first, ForwardIt last,
+                             OutputIt out) const {
+    return tree_.template find_batch_sorted<const_iterator>(first, last, out);
+  }
+
+  /**
+   * @brief lower_bound_batch for keys in ascending order, see
+   * find_batch_sorted
+   */
+  template <class ForwardIt, class OutputIt>
+  OutputIt lower_bound_batch_sorted(ForwardIt first, ForwardIt last,
+                                    OutputIt out) {
+    return tree_.template lower_bound_batch_sorted<iterator>(first, last, out);
+  }
+  template <class ForwardIt, class OutputIt>
+  OutputIt lower_bound_batch_sorted(ForwardIt first, ForwardIt last,
+                                    OutputIt out) const {
+    return tree_.template lower_bound_batch_sorted<const_iterator>(first, last,
+                                                                   out);
+  }
+
+  //**************************************************
+  // Snapshot
+  //**************************************************
+
+  /**
+   * @brief Copies the elements into a read-only frozen_map, which looks keys
+   * up without chasing node pointers. O(n), the map stays as it is. Needs
+   * frozen_map.hpp, map.hpp doesn't include it
+   *
+   * @return frozen_map<Key, T, Compare, Allocator>
+   */
+  frozen_map<Key, T, Compare, Allocator> freeze() const {
+    return frozen_map<Key, T, Compare, Allocator>(begin(), size(), key_comp(),
+                                                  get_allocator());
   }
 
   //**************************************************
   // Observers
   //**************************************************
 
-  key_compare key_comp() const { return key_compare(); }
+  key_compare key_comp() const { return tree_.key_comp(); }
 
-  value_compare value_comp() const { return value_compare(key_compare()); }
+  value_compare value_comp() const { return value_compare(tree_.key_comp()); }
 
  private:
   tree_type tree_;
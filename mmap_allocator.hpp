@@ -0,0 +1,151 @@
+#ifndef MMAP_ALLOCATOR_H
+#define MMAP_ALLOCATOR_H
+
+#include "utilities.hpp"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// mremap is Linux only, elsewhere mmap_allocator is a plain std::allocator
+#if defined(__linux__) && defined(MREMAP_MAYMOVE)
+#define FT_MMAP_ALLOCATOR_REMAP 1
+#else
+#define FT_MMAP_ALLOCATOR_REMAP 0
+#endif
+
+namespace ft {
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::mmap_allocator
+//
+// Allocator for huge vectors. Buffers of at least Threshold bytes are mapped
+// straight from the kernel, and reallocate() grows them with mremap: the
+// kernel moves the pages over instead of copying their contents, so growing
+// copies nothing and never needs the old and the new buffer at the same time.
+// With HugePages the buffers are advised to use transparent huge pages.
+// Smaller buffers come from std::allocator.
+//
+// ft::vector uses reallocate() for trivially relocatable types when it grows
+// at the end (push_back, resize, reserve).
+//////////////////////////////////////////////////////////////////////////////
+
+template <class T, std::size_t Threshold = 1024 * 1024, bool HugePages = false>
+class mmap_allocator : public std::allocator<T> {
+ public:
+  //**************************************************
+  // Typedefs
+  //**************************************************
+
+  typedef typename std::allocator<T>::pointer pointer;
+  typedef typename std::allocator<T>::size_type size_type;
+
+  template <class U>
+  struct rebind {
+    typedef mmap_allocator<U, Threshold, HugePages> other;
+  };
+
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  mmap_allocator() {}
+
+  mmap_allocator(const mmap_allocator& other) : std::allocator<T>(other) {}
+
+  template <class U>
+  mmap_allocator(const mmap_allocator<U, Threshold, HugePages>&) {}
+
+  //**************************************************
+  // Member functions
+  //**************************************************
+
+  pointer allocate(size_type n) {
+#if FT_MMAP_ALLOCATOR_REMAP
+    if (is_mapped_(n)) {
+      if (n > this->max_size()) throw std::bad_alloc();
+      void* p = mmap(NULL, mapped_size_(n), PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (p == MAP_FAILED) throw std::bad_alloc();
+      advise_(p, mapped_size_(n));
+      return static_cast<pointer>(p);
+    }
+#endif
+    return std::allocator<T>::allocate(n);
+  }
+
+  void deallocate(pointer p, size_type n) {
+#if FT_MMAP_ALLOCATOR_REMAP
+    if (is_mapped_(n)) {
+      munmap(p, mapped_size_(n));
+      return;
+    }
+#endif
+    std::allocator<T>::deallocate(p, n);
+  }
+
+  /**
+   * @brief Resizes the buffer p from old_n to new_n objects. The bytes of the
+   * first objects stay the same, but they may move to a new address
+   *
+   * @param p buffer of old_n objects
+   * @param old_n
+   * @param new_n
+   * @return pointer the resized buffer, or NULL if it can't be remapped
+   * (one of the sizes is below Threshold). p is untouched then
+   */
+  pointer reallocate(pointer p, size_type old_n, size_type new_n) {
+#if FT_MMAP_ALLOCATOR_REMAP
+    if (!is_mapped_(old_n) || !is_mapped_(new_n) || new_n > this->max_size())
+      return NULL;
+    void* q =
+        mremap(p, mapped_size_(old_n), mapped_size_(new_n), MREMAP_MAYMOVE);
+    if (q == MAP_FAILED) return NULL;
+    advise_(q, mapped_size_(new_n));
+    return static_cast<pointer>(q);
+#else
+    (void)p;
+    (void)old_n;
+    (void)new_n;
+    return NULL;
+#endif
+  }
+
+#if FT_MMAP_ALLOCATOR_REMAP
+ private:
+  // Whether a buffer of n objects is mapped
+  static bool is_mapped_(size_type n) {
+    return n >= (Threshold + sizeof(T) - 1) / sizeof(T);
+  }
+
+  // Bytes of n objects rounded up to whole pages
+  static std::size_t mapped_size_(size_type n) {
+    static const std::size_t page_size =
+        static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    std::size_t bytes = n * sizeof(T);
+    return (bytes + page_size - 1) / page_size * page_size;
+  }
+
+  static void advise_(void* p, std::size_t length) {
+#ifdef MADV_HUGEPAGE
+    if (HugePages) madvise(p, length, MADV_HUGEPAGE);
+#else
+    (void)p;
+    (void)length;
+#endif
+  }
+#endif
+};
+
+template <class T, std::size_t Threshold, bool HugePages>
+struct has_default_construct<mmap_allocator<T, Threshold, HugePages> >
+    : public true_type {};
+
+template <class T, std::size_t Threshold, bool HugePages>
+struct has_reallocate<mmap_allocator<T, Threshold, HugePages> >
+    : public true_type {};
+
+}  // namespace ft
+
+#endif  // MMAP_ALLOCATOR_H
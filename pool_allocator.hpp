@@ -0,0 +1,263 @@
+#ifndef POOL_ALLOCATOR_H
+#define POOL_ALLOCATOR_H
+
+#include "utilities.hpp"
+
+namespace ft {
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::pool_allocator
+//
+// Allocator for node based containers (map, set). Single objects are carved
+// out of large contiguous blocks and recycled through a free list, so a tree
+// with n nodes needs O(n / BlockSize) calls to operator new instead of n.
+// Requests for more than one object are passed through to operator new.
+//
+// Copies of an allocator share the same pool. Once the last object of the
+// pool is deallocated, all blocks but the newest one are handed back, so a
+// cleared tree returns its memory while a tree that keeps emptying and
+// refilling doesn't request a block every time. The last block goes when the
+// last copy of the allocator is destroyed.
+//////////////////////////////////////////////////////////////////////////////
+
+template <class T, std::size_t BlockSize = 1024>
+class pool_allocator {
+ public:
+  //**************************************************
+  // Typedefs
+  //**************************************************
+
+  typedef T value_type;
+  typedef T *pointer;
+  typedef const T *const_pointer;
+  typedef T &reference;
+  typedef const T &const_reference;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+
+  template <class U>
+  struct rebind {
+    typedef pool_allocator<U, BlockSize> other;
+  };
+
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  pool_allocator() : pool_(new pool_type()) {}
+
+  pool_allocator(const pool_allocator &other) : pool_(other.pool_) {
+    ++pool_->references;
+  }
+
+  // Objects of a different type need slots of a different size, so a rebound
+  // allocator always starts with its own pool
+  template <class U>
+  pool_allocator(const pool_allocator<U, BlockSize> &)
+      : pool_(new pool_type()) {}
+
+  ~pool_allocator() { detach_(); }
+
+  //**************************************************
+  // Operator overloads
+  //**************************************************
+
+  pool_allocator &operator=(const pool_allocator &other) {
+    if (pool_ != other.pool_) {
+      ++other.pool_->references;
+      detach_();
+      pool_ = other.pool_;
+    }
+    return *this;
+  }
+
+  bool operator==(const pool_allocator &other) const {
+    return pool_ == other.pool_;
+  }
+
+  bool operator!=(const pool_allocator &other) const {
+    return pool_ != other.pool_;
+  }
+
+  //**************************************************
+  // Member functions
+  //**************************************************
+
+  pointer address(reference x) const { return &x; }
+  const_pointer address(const_reference x) const { return &x; }
+
+  /**
+   * @brief Allocates storage for n objects. A single object is taken from the
+   * free list or carved from the current block, a new block is only requested
+   * when both are exhausted
+   *
+   * @param n number of objects
+   * @return pointer uninitialized storage for n objects
+   */
+  pointer allocate(size_type n, const void * = 0) {
+    if (n > max_size()) throw std::bad_alloc();
+    if (n != 1)
+      return static_cast<pointer>(::operator new(n * sizeof(value_type)));
+
+    ++pool_->live;
+    if (pool_->free_list) {
+      slot_ *tmp = pool_->free_list;
+      pool_->free_list = tmp->next;
+      return reinterpret_cast<pointer>(tmp);
+    }
+    if (pool_->cursor == pool_->block_end) add_block_();
+    pointer tmp = reinterpret_cast<pointer>(pool_->cursor);
+    pool_->cursor += slot_size_;
+    return tmp;
+  }
+
+  /**
+   * @brief Gives storage back to the pool. Once no object of the pool is alive
+   * anymore, all blocks but the newest are released and that one is reused
+   * from its start
+   *
+   * @param p pointer returned by allocate
+   * @param n the same n that was passed to allocate
+   */
+  void deallocate(pointer p, size_type n) {
+    if (n != 1) {
+      ::operator delete(p);
+      return;
+    }
+    slot_ *tmp = reinterpret_cast<slot_ *>(p);
+    tmp->next = pool_->free_list;
+    pool_->free_list = tmp;
+    if (--pool_->live == 0) rewind_(*pool_);
+  }
+
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type);
+  }
+
+  void construct(pointer p, const_reference value) {
+    new (static_cast<void *>(p)) value_type(value);
+  }
+
+  void destroy(pointer p) { p->~value_type(); }
+
+ private:
+  //**************************************************
+  // Private member types
+  //**************************************************
+
+  // Overlays a free slot to link it into the free list
+  struct slot_ {
+    slot_ *next;
+  };
+
+  // Header in front of every block. The union keeps the slots behind it
+  // aligned for any fundamental type
+  union block_header_ {
+    block_header_ *next;
+    long double align_ld;
+    double align_d;
+    long align_l;
+    void *align_p;
+  };
+
+  struct pool_type {
+    pool_type()
+        : references(1),
+          live(0),
+          blocks(NULL),
+          free_list(NULL),
+          cursor(NULL),
+          block_end(NULL),
+          next_block_size(first_block_size_) {}
+
+    size_type references;
+    size_type live;
+    block_header_ *blocks;
+    slot_ *free_list;
+    char *cursor;
+    char *block_end;
+    size_type next_block_size;
+  };
+
+  // Rounded up to a multiple of the pointer size, so the free list can be
+  // threaded through every slot. The size of an object is a multiple of its
+  // alignment, so objects that need more than that keep it as well
+  static const size_type slot_size_ =
+      (sizeof(value_type) + sizeof(slot_) - 1) / sizeof(slot_) * sizeof(slot_);
+  static const size_type first_block_size_ = BlockSize < 16 ? BlockSize : 16;
+
+  //**************************************************
+  // Private member objects
+  //**************************************************
+
+  pool_type *pool_;
+
+  //**************************************************
+  // Helper functions
+  //**************************************************
+
+  /**
+   * @brief Requests a new block from operator new. Block sizes start small
+   * and double up to BlockSize, so short lived trees don't pay for a full
+   * block
+   *
+   */
+  void add_block_() {
+    size_type count = pool_->next_block_size;
+    block_header_ *block = static_cast<block_header_ *>(
+        ::operator new(sizeof(block_header_) + count * slot_size_));
+    block->next = pool_->blocks;
+    pool_->blocks = block;
+    pool_->cursor = reinterpret_cast<char *>(block + 1);
+    pool_->block_end = pool_->cursor + count * slot_size_;
+    if (count < BlockSize)
+      pool_->next_block_size = std::min(count * 2, BlockSize);
+  }
+
+  // Frees all blocks but the newest, the one cursor carves from. Nothing is
+  // alive anymore, so it starts over with its first slot and an empty free
+  // list
+  static void rewind_(pool_type &pool) {
+    block_header_ *newest = pool.blocks;
+    if (!newest) return;
+    while (newest->next) {
+      block_header_ *tmp = newest->next;
+      newest->next = tmp->next;
+      ::operator delete(tmp);
+    }
+    pool.free_list = NULL;
+    pool.cursor = reinterpret_cast<char *>(newest + 1);
+  }
+
+  static void release_blocks_(pool_type &pool) {
+    while (pool.blocks) {
+      block_header_ *tmp = pool.blocks;
+      pool.blocks = tmp->next;
+      ::operator delete(tmp);
+    }
+    pool.free_list = NULL;
+    pool.cursor = NULL;
+    pool.block_end = NULL;
+    pool.next_block_size = first_block_size_;
+  }
+
+  void detach_() {
+    if (--pool_->references == 0) {
+      release_blocks_(*pool_);
+      delete pool_;
+    }
+    pool_ = NULL;
+  }
+};
+
+template <class T, std::size_t BlockSize>
+const typename pool_allocator<T, BlockSize>::size_type
+    pool_allocator<T, BlockSize>::slot_size_;
+
+template <class T, std::size_t BlockSize>
+const typename pool_allocator<T, BlockSize>::size_type
+    pool_allocator<T, BlockSize>::first_block_size_;
+
+}  // namespace ft
+
+#endif  // POOL_ALLOCATOR_H
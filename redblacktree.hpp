@@ -7,35 +7,55 @@ namespace ft {
 
 enum node_color { RED, BLACK };
 
+// A node is its value and three pointers. Nodes are aligned to at least two
+// bytes, so the lowest bit of the parent pointer is always 0 and holds the
+// color instead. The only node without a value of the tree is off_the_end, it
+// is recognized by its address (or by its left child pointing to itself)
 template <class U>
 class rb_node {
  public:
-  rb_node()
-      : data(U()),
-        parent(NULL),
-        left_child(NULL),
-        right_child(NULL),
-        color(RED),
-        is_null_node(true) {}
+  rb_node() : data(U()), left_child(NULL), right_child(NULL), parent_(0) {}
 
   rb_node(const U &value)
-      : data(U(value)),
-        parent(NULL),
-        left_child(NULL),
-        right_child(NULL),
-        color(RED),
-        is_null_node(false) {}
+      : data(value), left_child(NULL), right_child(NULL), parent_(0) {}
+
+  rb_node *parent() const {
+    return reinterpret_cast<rb_node *>(parent_ & ~color_mask_);
+  }
+
+  void set_parent(rb_node *parent) {
+    parent_ = reinterpret_cast<std::size_t>(parent) | (parent_ & color_mask_);
+  }
+
+  node_color color() const {
+    return static_cast<node_color>(parent_ & color_mask_);
+  }
+
+  void set_color(node_color color) {
+    parent_ = (parent_ & ~color_mask_) | static_cast<std::size_t>(color);
+  }
+
+  bool is_off_the_end() const { return left_child == this; }
 
   U data;
-  rb_node *parent;
   rb_node *left_child;
   rb_node *right_child;
-  node_color color;
-  bool is_null_node;
+
+ private:
+  static const std::size_t color_mask_ = 1;
+
+  // parent pointer | color
+  std::size_t parent_;
 };
 
+template <class U>
+const std::size_t rb_node<U>::color_mask_;
+
+// Nodes store a value_type, KeyOfValue extracts the key that Compare orders.
+// Lookups take a key, so no value_type has to be built to search the tree.
 template <class T, class Compare = std::less<T>,
-          class Allocator = std::allocator<T> >
+          class Allocator = std::allocator<T>,
+          class KeyOfValue = ft::identity<T> >
 class redblacktree {
  public:
   //**************************************************
@@ -43,6 +63,7 @@ class redblacktree {
   //**************************************************
 
   typedef Compare key_compare;
+  typedef typename KeyOfValue::result_type key_type;
 
   typedef T value_type;
   typedef std::size_t size_type;
@@ -62,45 +83,34 @@ class redblacktree {
 
   redblacktree(key_compare comparator, const Allocator &alloc = Allocator())
       : allocator_(alloc), cmp_(comparator), size_(0) {
-    off_the_end_ = new_node_();
-    off_the_end_->color = BLACK;
-    off_the_end_->left_child = off_the_end_;
-    off_the_end_->right_child = off_the_end_;
+    off_the_end_ = make_off_the_end_();
     root_ = off_the_end_;
     first_ = off_the_end_;
     last_ = off_the_end_;
-    off_the_end_->parent = last_;
   }
 
   redblacktree(const redblacktree &other)
       : allocator_(allocator_type()), cmp_(other.cmp_), size_(other.size_) {
-    off_the_end_ = new_node_();
-    off_the_end_->color = BLACK;
-    off_the_end_->left_child = off_the_end_;
-    off_the_end_->right_child = off_the_end_;
+    off_the_end_ = make_off_the_end_();
     root_ = off_the_end_;
     first_ = off_the_end_;
     last_ = off_the_end_;
 
-    if (other.root_->is_null_node) return;
-
-    root_ = new_node_(other.root_->data, off_the_end_);
-    root_->color = BLACK;
-    root_->left_child = copy_subtree_(other.root_->left_child, root_);
-    root_->right_child = copy_subtree_(other.root_->right_child, root_);
-
-    node_type *tmp = root_;
-    while (!tmp->left_child->is_null_node) tmp = tmp->left_child;
-    first_ = tmp;
-
-    tmp = root_;
-    while (!tmp->right_child->is_null_node) tmp = tmp->right_child;
-    set_last_(tmp);
+    if (other.root_ == other.off_the_end_) return;
+    try {
+      copy_tree_(other);
+    } catch (...) {
+      // Nodes that weren't copied yet are still linked to off_the_end, so the
+      // partial tree can be torn down normally
+      clear();
+      destroy_off_the_end_();
+      throw;
+    }
   }
 
   ~redblacktree() {
     clear();
-    destroy_node_(off_the_end_);
+    destroy_off_the_end_();
   }
 
   //**************************************************
@@ -125,73 +135,173 @@ class redblacktree {
    * pointer to the already existing duplicate and false
    */
   ft::pair<node_type *, bool> insert(const value_type &value) {
-    // Case 1: first insertion. Make a new root.
-    if (root_->is_null_node) {
-      root_ = new_node_(value, off_the_end_);
-      root_->color = BLACK;
-      first_ = root_;
-      set_last_(root_);
-      size_ = 1;
-      return ft::pair<node_type *, bool>(root_, true);
-    }
-
-    // Case 2: insertion into existing tree
     // Step 1: find spot to insert into
+    ft::pair<node_type *, bool> position = find_position(key_of_(value));
+    if (position.second)
+      return ft::pair<node_type *, bool>(position.first, false);
+
+    // Step 2: make new node at spot
+    return ft::pair<node_type *, bool>(insert_at(position.first, value), true);
+  }
+
+  /**
+   * @brief Looks for the node with key in a single descent
+   *
+   * @param key
+   * @return ft::pair<node_type *, bool> the node with key and true if there is
+   * one. Otherwise the node that would become the parent of a node with key
+   * (off_the_end if the tree is empty) and false
+   */
+  ft::pair<node_type *, bool> find_position(const key_type &key) const {
     node_type *tmp = root_;
     node_type *parent = off_the_end_;
-    while (!tmp->is_null_node) {
+    while (tmp != off_the_end_) {
+      prefetch_children_(tmp);
       parent = tmp;
-      if (key_is_less_(value, tmp->data)) {
+      if (key_is_less_(key, key_of_(tmp->data))) {
         tmp = tmp->left_child;
-      } else if (key_is_greater_(value, tmp->data)) {
+      } else if (key_is_greater_(key, key_of_(tmp->data))) {
         tmp = tmp->right_child;
       } else {
-        return ft::pair<node_type *, bool>(tmp, false);
+        return ft::pair<node_type *, bool>(tmp, true);
       }
     }
+    return ft::pair<node_type *, bool>(parent, false);
+  }
 
-    // Step 2: make new node at spot
-    tmp = new_node_(value, parent);
-    ++size_;
-    if (key_is_less_(value, parent->data))
-      parent->left_child = tmp;
-    else
-      parent->right_child = tmp;
-
-    // Step 3:If the key is the smallest and/or greatest, update member
-    // variables
-    if (key_is_less_(tmp->data, first_->data))
-      first_ = tmp;
-    else if (key_is_greater_(tmp->data, last_->data))
-      set_last_(tmp);
+  /**
+   * @brief Inserts value below parent without searching the tree again
+   *
+   * @param parent the parent returned by find_position for the key of value
+   * @param value
+   * @return node_type* pointer to the new node
+   */
+  node_type *insert_at(node_type *parent, const value_type &value) {
+    // First insertion. Make a new root.
+    if (parent == off_the_end_) {
+      root_ = new_node_(value, off_the_end_);
+      root_->set_color(BLACK);
+      first_ = root_;
+      set_last_(root_);
+      size_ = 1;
+      return root_;
+    }
+    return insert_at_(parent, value,
+                      key_is_less_(key_of_(value), key_of_(parent->data)));
+  }
 
-    // Step 4: Rebalance tree
-    rebalance_insert_(tmp);
+  /**
+   * @brief Inserts a node into the tree, using hint as a starting point. If
+   * the value belongs directly before or after hint, the node is linked in
+   * without searching the tree, otherwise this falls back to insert(value)
+   *
+   * @param hint node next to which the value is expected, can be off_the_end
+   * @param value
+   * @return ft::pair<node_type *, bool> same as insert(value)
+   */
+  ft::pair<node_type *, bool> insert(node_type *hint,
+                                     const value_type &value) {
+    if (root_ == off_the_end_)
+      return ft::pair<node_type *, bool>(insert_at(off_the_end_, value), true);
+
+    const key_type &key = key_of_(value);
+    if (hint == off_the_end_) {
+      // Appending behind the greatest value
+      if (key_is_greater_(key, key_of_(last_->data)))
+        return ft::pair<node_type *, bool>(insert_at_(last_, value, false),
+                                           true);
+    } else if (key_is_less_(key, key_of_(hint->data))) {
+      // Value belongs between the predecessor of hint and hint
+      node_type *before = NULL;
+      if (hint != first_) before = get_inorder_predecessor_(hint);
+      if (!before || key_is_greater_(key, key_of_(before->data))) {
+        // Either hint has a free left slot or its predecessor (the greatest
+        // node of hint's left subtree) has a free right slot
+        if (hint->left_child == off_the_end_)
+          return ft::pair<node_type *, bool>(insert_at_(hint, value, true),
+                                             true);
+        return ft::pair<node_type *, bool>(insert_at_(before, value, false),
+                                           true);
+      }
+    } else if (key_is_greater_(key, key_of_(hint->data))) {
+      // Value belongs between hint and the successor of hint
+      node_type *after = NULL;
+      if (hint != last_) after = get_inorder_successor_(hint);
+      if (!after || key_is_less_(key, key_of_(after->data))) {
+        if (hint->right_child == off_the_end_)
+          return ft::pair<node_type *, bool>(insert_at_(hint, value, false),
+                                             true);
+        return ft::pair<node_type *, bool>(insert_at_(after, value, true),
+                                           true);
+      }
+    } else {
+      return ft::pair<node_type *, bool>(hint, false);
+    }
+    return insert(value);
+  }
 
-    return ft::pair<node_type *, bool>(tmp, true);
+  /**
+   * @brief Inserts the range [first;last). If the tree is empty and the range
+   * is sorted without duplicates, a balanced tree is built from it in O(n),
+   * otherwise the elements are inserted one by one
+   *
+   * @tparam InputIt
+   * @param first
+   * @param last
+   */
+  template <class InputIt>
+  void insert_range(InputIt first, InputIt last) {
+    typedef typename ft::iterator_traits<InputIt>::iterator_category category;
+    insert_range_(first, last, category());
   }
 
   /**
-   * @brief deletes a node
+   * @brief deletes the node with the given key
    *
-   * @param pos pointer to the node(use the find member function to )
+   * @param key
+   * @return true if a node was deleted, false if there was no node with key
    */
-  bool erase(value_type data) {
-    node_type *node = find(data);
-    if (!node->is_null_node) {
+  bool erase(const key_type &key) {
+    node_type *node = find(key);
+    if (node != off_the_end_) {
       delete_(node);
       return true;
     } else
       return false;
   }
 
+  /**
+   * @brief deletes a node without searching the tree for it
+   *
+   * @param node a node of this tree (not off_the_end)
+   */
+  void erase(node_type *node) { delete_(node); }
+
+  /**
+   * @brief deletes all nodes in the range [first;last)
+   *
+   * @param first
+   * @param last a node of this tree or off_the_end
+   */
+  void erase(node_type *first, node_type *last) {
+    if (first == first_ && last == off_the_end_) {
+      clear();
+      return;
+    }
+    while (first != last) {
+      node_type *next = get_inorder_successor_(first);
+      delete_(first);
+      first = next;
+    }
+  }
+
   size_type size() const { return size_; }
 
   void clear() {
-    if (!root_->is_null_node) destroy_subtree_(root_);
+    if (root_ != off_the_end_) destroy_subtree_(root_);
     root_ = off_the_end_;
     first_ = off_the_end_;
-    last_ = off_the_end_;
+    set_last_(off_the_end_);
     size_ = 0;
   }
 
@@ -206,30 +316,32 @@ class redblacktree {
   }
 
   /**
-   * @brief tries to find a node with the given value. Returns a pointer to the
+   * @brief tries to find a node with the given key. Returns a pointer to the
    * off_the_end node if nothing was found
    *
-   * @param value
+   * @param key
    * @return node_type* either pointer to the found node or the off_the_end node
    */
-  node_type *find(const value_type &value) const {
+  node_type *find(const key_type &key) const {
     node_type *current = root_;
-    while (!current->is_null_node) {
-      if (key_is_equal_(value, current->data))
-        return current;
-      else if (key_is_less_(value, current->data))
+    while (current != off_the_end_) {
+      prefetch_children_(current);
+      if (key_is_less_(key, key_of_(current->data)))
         current = current->left_child;
-      else
+      else if (key_is_greater_(key, key_of_(current->data)))
         current = current->right_child;
+      else
+        return current;
     }
     return current;
   }
 
-  node_type *lower_bound(const value_type &value) const {
+  node_type *lower_bound(const key_type &key) const {
     node_type *node = root_;
     node_type *result = off_the_end_;
-    while (!node->is_null_node) {
-      if (key_is_less_(node->data, value)) {
+    while (node != off_the_end_) {
+      prefetch_children_(node);
+      if (key_is_less_(key_of_(node->data), key)) {
         node = node->right_child;
       } else {
         result = node;
@@ -239,11 +351,12 @@ class redblacktree {
     return result;
   }
 
-  node_type *upper_bound(const value_type &value) const {
+  node_type *upper_bound(const key_type &key) const {
     node_type *node = root_;
     node_type *result = off_the_end_;
-    while (!node->is_null_node) {
-      if (key_is_greater_(node->data, value)) {
+    while (node != off_the_end_) {
+      prefetch_children_(node);
+      if (key_is_greater_(key_of_(node->data), key)) {
         result = node;
         node = node->left_child;
       } else {
@@ -253,6 +366,54 @@ class redblacktree {
     return result;
   }
 
+  /**
+   * @brief looks up every key of [first;last) and writes Iterator(node) to
+   * out for each, with the off_the_end node for missing keys. The descents of
+   * batch_size_ keys run side by side, one level at a time, and the next node
+   * of each descent is prefetched, so the cache misses of a batch overlap
+   * instead of being paid one after the other
+   *
+   * @tparam Iterator type written to out, constructed from a node_type*
+   * @param first
+   * @param last
+   * @param out
+   * @return OutputIt out advanced past the last written iterator
+   */
+  template <class Iterator, class ForwardIt, class OutputIt>
+  OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const {
+    return lookup_batch_<Iterator>(first, last, out, true);
+  }
+
+  /**
+   * @brief same as find_batch, but writes the lower bound of every key
+   */
+  template <class Iterator, class ForwardIt, class OutputIt>
+  OutputIt lower_bound_batch(ForwardIt first, ForwardIt last,
+                             OutputIt out) const {
+    return lookup_batch_<Iterator>(first, last, out, false);
+  }
+
+  /**
+   * @brief same as find_batch for keys in ascending order. Each search starts
+   * at the result for the previous key and only climbs as far up the tree as
+   * needed, so close keys skip the upper levels. A key smaller than the one
+   * before it is searched from the root
+   */
+  template <class Iterator, class ForwardIt, class OutputIt>
+  OutputIt find_batch_sorted(ForwardIt first, ForwardIt last,
+                             OutputIt out) const {
+    return lookup_sorted_<Iterator>(first, last, out, true);
+  }
+
+  /**
+   * @brief same as find_batch_sorted, but writes the lower bound of every key
+   */
+  template <class Iterator, class ForwardIt, class OutputIt>
+  OutputIt lower_bound_batch_sorted(ForwardIt first, ForwardIt last,
+                                    OutputIt out) const {
+    return lookup_sorted_<Iterator>(first, last, out, false);
+  }
+
   /**
    * @brief Returns a pointer to the node with the lowest value or a pointer to
    * the off_the_end node if the tree is empty
@@ -273,6 +434,8 @@ class redblacktree {
 
   size_type max_size() const { return allocator_.max_size(); }
 
+  key_compare key_comp() const { return cmp_; }
+
   allocator_type get_allocator() const { return allocator_; }
 
   //**************************************************
@@ -292,24 +455,319 @@ class redblacktree {
   // General helper functions
   //**************************************************
 
+  // Number of descents interleaved by the batch lookups. Enough to keep the
+  // memory system busy, few enough that the state stays in registers/L1
+  static const size_type batch_size_ = 16;
+
+  /**
+   * @brief implementation of find_batch and lower_bound_batch. Every pass
+   * moves each unfinished descent of the batch one level down
+   *
+   * @param exact whether missing keys give off_the_end (find) or their lower
+   * bound
+   */
+  template <class Iterator, class ForwardIt, class OutputIt>
+  OutputIt lookup_batch_(ForwardIt first, ForwardIt last, OutputIt out,
+                         bool exact) const {
+    // Iterators, not addresses of the keys: *first may be converted to a
+    // temporary key_type
+    ForwardIt keys[batch_size_];
+    node_type *nodes[batch_size_];
+    node_type *results[batch_size_];
+
+    while (first != last) {
+      size_type count = 0;
+      for (; count < batch_size_ && first != last; ++count, ++first) {
+        keys[count] = first;
+        nodes[count] = root_;
+        results[count] = off_the_end_;
+      }
+      for (bool descending = true; descending;) {
+        descending = false;
+        for (size_type i = 0; i < count; ++i) {
+          node_type *node = nodes[i];
+          if (node == off_the_end_) continue;
+          if (key_is_less_(key_of_(node->data), *keys[i])) {
+            node = node->right_child;
+          } else {
+            results[i] = node;
+            node = node->left_child;
+          }
+          prefetch_(node);
+          nodes[i] = node;
+          descending = true;
+        }
+      }
+      for (size_type i = 0; i < count; ++i)
+        *out++ = Iterator(exact ? exact_match_(results[i], *keys[i])
+                                : results[i]);
+    }
+    return out;
+  }
+
+  /**
+   * @brief implementation of find_batch_sorted and lower_bound_batch_sorted
+   *
+   * @param exact whether missing keys give off_the_end (find) or their lower
+   * bound
+   */
+  template <class Iterator, class ForwardIt, class OutputIt>
+  OutputIt lookup_sorted_(ForwardIt first, ForwardIt last, OutputIt out,
+                          bool exact) const {
+    node_type *finger = root_;
+    // An iterator, not the address of the key: *first may be converted to a
+    // temporary key_type that is gone by the next element
+    ForwardIt previous = last;
+    for (; first != last; ++first) {
+      const key_type &key = *first;
+      if (previous != last && key_is_less_(key, *previous)) finger = root_;
+      node_type *result = lower_bound_from_(finger, key);
+      *out++ = Iterator(exact ? exact_match_(result, key) : result);
+      // Once a key has no lower bound, no greater key has one either
+      if (result != off_the_end_) finger = result;
+      previous = first;
+    }
+    return out;
+  }
+
+  /**
+   * @brief finds the lower bound of key, starting at finger instead of the
+   * root. Climbs from finger until an ancestor is not less than key (the
+   * lower bound is then that ancestor or inside the subtree below it), then
+   * descends as lower_bound does
+   *
+   * @param finger the lower bound of a key not greater than key, or root
+   * @param key
+   * @return node_type* the first node not less than key or off_the_end
+   */
+  node_type *lower_bound_from_(node_type *finger, const key_type &key) const {
+    if (finger == off_the_end_) return off_the_end_;
+    node_type *node = finger;
+    node_type *result = off_the_end_;
+    while (node != root_) {
+      node_type *parent = node->parent();
+      if (node == parent->left_child &&
+          !key_is_less_(key_of_(parent->data), key)) {
+        result = parent;
+        break;
+      }
+      node = parent;
+    }
+    while (node != off_the_end_) {
+      prefetch_children_(node);
+      if (key_is_less_(key_of_(node->data), key)) {
+        node = node->right_child;
+      } else {
+        result = node;
+        node = node->left_child;
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief turns the lower bound of key into the result of find(key)
+   *
+   * @param node lower bound of key
+   * @param key
+   * @return node_type* node if its key is equal to key, otherwise off_the_end
+   */
+  node_type *exact_match_(node_type *node, const key_type &key) const {
+    if (node == off_the_end_ || key_is_less_(key, key_of_(node->data)))
+      return off_the_end_;
+    return node;
+  }
+
+  // Input iterators can only be read once. Hinting off_the_end still makes
+  // sorted input cheap
+  template <class InputIt>
+  void insert_range_(InputIt first, InputIt last, std::input_iterator_tag) {
+    while (first != last) insert(off_the_end_, *(first++));
+  }
+
+  template <class ForwardIt>
+  void insert_range_(ForwardIt first, ForwardIt last,
+                     std::forward_iterator_tag) {
+    size_type count = 0;
+    if (root_ == off_the_end_ && is_sorted_unique_(first, last, count)) {
+      build_(first, count);
+      return;
+    }
+    insert_range_(first, last, std::input_iterator_tag());
+  }
+
+  /**
+   * @brief checks if the keys of [first;last) are strictly ascending and counts
+   * the elements on the way. Stops at the first element out of order
+   *
+   * @param first
+   * @param last
+   * @param count set to the length of the range if it is sorted
+   * @return true if the range is sorted and has no duplicates
+   */
+  template <class ForwardIt>
+  bool is_sorted_unique_(ForwardIt first, ForwardIt last, size_type &count) {
+    count = 0;
+    if (first == last) return true;
+    ForwardIt previous = first;
+    ++count;
+    while (++first != last) {
+      if (!key_is_less_(key_of_(*previous), key_of_(*first))) return false;
+      previous = first;
+      ++count;
+    }
+    return true;
+  }
+
+  /**
+   * @brief builds a balanced tree out of a sorted range of count elements. The
+   * tree must be empty. Nodes are made in order, so they end up next to each
+   * other in memory
+   *
+   * @param first start of the sorted range
+   * @param count length of the range
+   */
+  template <class ForwardIt>
+  void build_(ForwardIt first, size_type count) {
+    if (!count) return;
+    // All levels above red_depth are full, so coloring only the nodes on the
+    // last, partially filled level red keeps every path equally black
+    size_type red_depth = 0;
+    while (((size_type)2 << red_depth) <= count + 1) ++red_depth;
+    root_ = build_subtree_(first, count, 0, red_depth);
+    root_->set_parent(off_the_end_);
+    size_ = count;
+    first_ = min_value_(root_);
+    set_last_(max_value_(root_));
+  }
+
+  /**
+   * @brief recursively builds a subtree out of the next count elements
+   * (inorder: left subtree, node, right subtree) and advances first past them
+   *
+   * @param first iterator to the next element, advanced by count
+   * @param count number of nodes in the subtree
+   * @param depth depth of the subtree's root
+   * @param red_depth depth at which nodes are colored red
+   * @return node_type* root of the subtree (parent not set yet). If a copy
+   * throws, the nodes built so far are freed again
+   */
+  template <class ForwardIt>
+  node_type *build_subtree_(ForwardIt &first, size_type count, size_type depth,
+                            size_type red_depth) {
+    if (!count) return off_the_end_;
+    size_type count_left = (count - 1) / 2;
+    node_type *left = build_subtree_(first, count_left, depth + 1, red_depth);
+    node_type *node;
+    try {
+      node = new_node_(*first, off_the_end_);
+    } catch (...) {
+      destroy_subtree_(left);
+      throw;
+    }
+    ++first;
+    node->set_color(depth == red_depth ? RED : BLACK);
+    node->left_child = left;
+    if (left != off_the_end_) left->set_parent(node);
+    node_type *right;
+    try {
+      right =
+          build_subtree_(first, count - 1 - count_left, depth + 1, red_depth);
+    } catch (...) {
+      destroy_subtree_(node);
+      throw;
+    }
+    node->right_child = right;
+    if (right != off_the_end_) right->set_parent(node);
+    return node;
+  }
+
+  /**
+   * @brief makes a new node as the child of parent, updates first_/last_ and
+   * rebalances the tree. The child slot on that side of parent must be free
+   *
+   * @param parent
+   * @param value
+   * @param as_left_child whether the node becomes the left or right child
+   * @return node_type* pointer to the new node
+   */
+  node_type *insert_at_(node_type *parent, const value_type &value,
+                        bool as_left_child) {
+    node_type *tmp = new_node_(value, parent);
+    ++size_;
+    if (as_left_child) {
+      parent->left_child = tmp;
+      // Only a node left of first_ can be smaller than all others
+      if (parent == first_) first_ = tmp;
+    } else {
+      parent->right_child = tmp;
+      if (parent == last_) set_last_(tmp);
+    }
+    rebalance_insert_(tmp);
+    return tmp;
+  }
+
   /**
    * @brief deletes a node and rebalances the tree if needed
    *
    * @param node the node to be deleted
    */
   void delete_(node_type *node) {
-    if (has_equal_or_fewer_than_one_children(node)) {
-      bool doubleblack = is_doubleblack_(node);
-      node_type *parent = node->parent;
-      // remove the node and give us its replacement (removed node always has at
-      // most 1 children! So either a valid child or pointer to off_the_end)
-      node_type *replacement = remove_(node);
-      rebalance_delete_(replacement, parent, doubleblack);
+    // A node with two children first trades places with its predecessor, so
+    // it has at most one child. The data stays where it is, so pointers to
+    // other nodes remain valid
+    if (!has_equal_or_fewer_than_one_children(node))
+      swap_with_predecessor_(node, get_inorder_predecessor_(node));
+    bool doubleblack = is_doubleblack_(node);
+    node_type *parent = node->parent();
+    // remove the node and give us its replacement (removed node always has at
+    // most 1 children! So either a valid child or pointer to off_the_end)
+    node_type *replacement = remove_(node);
+    rebalance_delete_(replacement, parent, doubleblack);
+  }
+
+  /**
+   * @brief swaps the positions (links and colors) of a node with two children
+   * and its inorder predecessor. Afterwards node has no right child
+   *
+   * @param node a node with two children
+   * @param predecessor the greatest node in the left subtree of node
+   */
+  void swap_with_predecessor_(node_type *node, node_type *predecessor) {
+    node_type *parent = node->parent();
+    bool node_is_left_child = is_left_child_(node);
+    node_type *right = node->right_child;
+    node_type *predecessor_left = predecessor->left_child;
+
+    if (predecessor == node->left_child) {
+      predecessor->left_child = node;
+      node->set_parent(predecessor);
     } else {
-      node_type *predecessor = get_inorder_predecessor_(node);
-      std::swap(predecessor->data, node->data);
-      delete_(predecessor);
+      // predecessor is the right child of its parent
+      predecessor->parent()->right_child = node;
+      node->set_parent(predecessor->parent());
+      predecessor->left_child = node->left_child;
+      predecessor->left_child->set_parent(predecessor);
     }
+    predecessor->right_child = right;
+    right->set_parent(predecessor);
+    node->left_child = predecessor_left;
+    if (predecessor_left != off_the_end_) predecessor_left->set_parent(node);
+    node->right_child = off_the_end_;
+
+    if (node == root_) {
+      root_ = predecessor;
+      predecessor->set_parent(off_the_end_);
+    } else {
+      if (node_is_left_child)
+        parent->left_child = predecessor;
+      else
+        parent->right_child = predecessor;
+      predecessor->set_parent(parent);
+    }
+    node_color color = node->color();
+    node->set_color(predecessor->color());
+    predecessor->set_color(color);
   }
 
   /**
@@ -323,8 +781,8 @@ class redblacktree {
    */
   void rebalance_delete_(node_type *node, node_type *parent,
                          bool is_doubleblack) {
-    if (node->color == RED)
-      node->color = BLACK;
+    if (node->color() == RED)
+      node->set_color(BLACK);
     else if (node != root_ && is_doubleblack)
       resolve_doubleblack_(node, parent);
   }
@@ -349,78 +807,79 @@ class redblacktree {
     else
       sibling = parent->left_child;
 
-    if (sibling->color == BLACK) {
+    if (sibling->color() == BLACK) {
       if (has_red_child_(sibling)) {
         // Case 1: sibling is black and has a red child
         // If there are two red children, get the outer one
         node_type *red_child = get_outer_red_child_(sibling);
         if (insert_is_zick_zack_(red_child, sibling)) {
           node_type *other_child = get_sibling_(red_child);
-          if (!other_child->is_null_node) {
+          if (other_child != off_the_end_) {
             rotate_(other_child, sibling, red_child);
-            red_child->color = parent->color;
-            sibling->color = BLACK;
-            parent->color = BLACK;
+            red_child->set_color(parent->color());
+            sibling->set_color(BLACK);
+            parent->set_color(BLACK);
             restructure_(sibling, red_child, parent);
             return;
           } else {
             if (is_left_child_(red_child)) {
               sibling->left_child = red_child->right_child;
-              if (!sibling->left_child->is_null_node)
-                sibling->left_child->parent = sibling;
+              if (sibling->left_child != off_the_end_)
+                sibling->left_child->set_parent(sibling);
               red_child->right_child = sibling;
             } else {
               sibling->right_child = red_child->left_child;
-              if (!sibling->right_child->is_null_node)
-                sibling->right_child->parent = sibling;
+              if (sibling->right_child != off_the_end_)
+                sibling->right_child->set_parent(sibling);
               red_child->left_child = sibling;
             }
 
             if (is_left_child_(sibling))
-              sibling->parent->left_child = red_child;
+              sibling->parent()->left_child = red_child;
             else
-              sibling->parent->right_child = red_child;
-
-            red_child->parent = sibling->parent;
-            sibling->parent = red_child;
-            sibling->color = parent->color;
-            red_child->color = parent->color;
-            sibling->color = BLACK;
-            parent->color = BLACK;
+              sibling->parent()->right_child = red_child;
+
+            red_child->set_parent(sibling->parent());
+            sibling->set_parent(red_child);
+            sibling->set_color(parent->color());
+            red_child->set_color(parent->color());
+            sibling->set_color(BLACK);
+            parent->set_color(BLACK);
             restructure_(sibling, red_child, parent);
             return;
           }
         } else {
-          sibling->color = parent->color;
-          red_child->color = BLACK;
-          node->color = BLACK;
-          parent->color = BLACK;
+          sibling->set_color(parent->color());
+          red_child->set_color(BLACK);
+          node->set_color(BLACK);
+          parent->set_color(BLACK);
           restructure_(red_child, sibling, parent);
         }
       } else {
         // Case 2: sibling is black and has no red child
-        sibling->color = RED;
-        if (parent->color == RED)
-          parent->color = BLACK;
+        sibling->set_color(RED);
+        if (parent->color() == RED)
+          parent->set_color(BLACK);
         else if (parent != root_)
-          resolve_doubleblack_(parent, parent->parent);
+          resolve_doubleblack_(parent, parent->parent());
       }
     } else {
       // Case 3: sibling is red
-      sibling->color = BLACK;
-      parent->color = RED;
+      sibling->set_color(BLACK);
+      parent->set_color(RED);
       rotate_(node, parent, sibling);
       resolve_doubleblack_(node, parent);
     }
   }
 
   bool is_doubleblack_(node_type *node) {
-    return node->color == BLACK && node->left_child->color == BLACK &&
-           node->right_child->color == BLACK;
+    return node->color() == BLACK && node->left_child->color() == BLACK &&
+           node->right_child->color() == BLACK;
   }
 
   bool has_red_child_(node_type *node) {
-    return node->left_child->color == RED || node->right_child->color == RED;
+    return node->left_child->color() == RED ||
+           node->right_child->color() == RED;
   }
 
   /**
@@ -433,8 +892,8 @@ class redblacktree {
    * @return node_type* the outer red child
    */
   node_type *get_outer_red_child_(node_type *node) {
-    if (node->left_child->color == RED) {
-      if (node->right_child->color == RED && !is_left_child_(node))
+    if (node->left_child->color() == RED) {
+      if (node->right_child->color() == RED && !is_left_child_(node))
         return node->right_child;
       else
         return node->left_child;
@@ -460,19 +919,19 @@ class redblacktree {
     // if node is the root, it's easy:
     if (node == root_) {
       root_ = tmp;
-      tmp->parent = off_the_end_;
+      tmp->set_parent(off_the_end_);
       destroy_node_(node);
       --size_;
       return tmp;
     }
 
-    node_type *parent = node->parent;
+    node_type *parent = node->parent();
     if (is_left_child_(node))
       parent->left_child = tmp;
     else
       parent->right_child = tmp;
 
-    if (!tmp->is_null_node) tmp->parent = parent;
+    if (tmp != off_the_end_) tmp->set_parent(parent);
     destroy_node_(node);
     --size_;
     return tmp;
@@ -486,13 +945,13 @@ class redblacktree {
    * @return node_type* the successor
    */
   node_type *get_inorder_successor_(node_type *node) {
-    if (!node->right_child->is_null_node)
+    if (node->right_child != off_the_end_)
       return min_value_(node->right_child);
     else {
-      node_type *parent = node->parent;
-      while (!parent->is_null_node && node == parent->right_child) {
+      node_type *parent = node->parent();
+      while (parent != off_the_end_ && node == parent->right_child) {
         node = parent;
-        parent = node->parent;
+        parent = node->parent();
       }
       return parent;
     }
@@ -506,13 +965,13 @@ class redblacktree {
    * @return node_type* the predecessor
    */
   node_type *get_inorder_predecessor_(node_type *node) {
-    if (!node->left_child->is_null_node)
+    if (node->left_child != off_the_end_)
       return max_value_(node->left_child);
     else {
-      node_type *parent = node->parent;
-      while (!parent->is_null_node && node == parent->left_child) {
+      node_type *parent = node->parent();
+      while (parent != off_the_end_ && node == parent->left_child) {
         node = parent;
-        parent = node->parent;
+        parent = node->parent();
       }
       return parent;
     }
@@ -526,7 +985,7 @@ class redblacktree {
    */
   node_type *min_value_(node_type *node) const {
     node_type *current = node;
-    while (!current->left_child->is_null_node) current = current->left_child;
+    while (current->left_child != off_the_end_) current = current->left_child;
     return current;
   }
 
@@ -538,7 +997,7 @@ class redblacktree {
    */
   node_type *max_value_(node_type *node) const {
     node_type *current = node;
-    while (!current->right_child->is_null_node) current = current->right_child;
+    while (current->right_child != off_the_end_) current = current->right_child;
     return current;
   }
 
@@ -550,14 +1009,15 @@ class redblacktree {
    * @return node_type* the child or a pointer to the off_the_end node
    */
   node_type *get_child_(node_type *node) {
-    if (!node->left_child->is_null_node)
+    if (node->left_child != off_the_end_)
       return node->left_child;
     else
       return node->right_child;
   }
 
   bool has_equal_or_fewer_than_one_children(node_type *node) {
-    return node->left_child->is_null_node || node->right_child->is_null_node;
+    return node->left_child == off_the_end_ ||
+           node->right_child == off_the_end_;
   }
 
   /**
@@ -570,41 +1030,41 @@ class redblacktree {
    */
   void rebalance_insert_(node_type *node) {
     if (node == root_) {
-      node->color = BLACK;
+      node->set_color(BLACK);
       return;
     }
-    node_type *parent = node->parent;
-    if (parent->color == RED) {
-      node_type *grandparent = parent->parent;
+    node_type *parent = node->parent();
+    if (parent->color() == RED) {
+      node_type *grandparent = parent->parent();
 
       if (insert_is_zick_zack_(node, parent)) {
         node_type *sibling = get_sibling_(node);
-        if (!sibling->is_null_node) {
+        if (sibling != off_the_end_) {
           rotate_(sibling, parent, node);
           rebalance_insert_(parent);
           return;
         } else {
           if (is_left_child_(node)) {
             parent->left_child = node->right_child;
-            if (!parent->left_child->is_null_node)
-              parent->left_child->parent = parent;
+            if (parent->left_child != off_the_end_)
+              parent->left_child->set_parent(parent);
             parent->right_child = off_the_end_;
             node->right_child = parent;
           } else {
             parent->right_child = node->left_child;
-            if (!parent->right_child->is_null_node)
-              parent->right_child->parent = parent;
+            if (parent->right_child != off_the_end_)
+              parent->right_child->set_parent(parent);
             parent->left_child = off_the_end_;
             node->left_child = parent;
           }
 
           if (is_left_child_(parent))
-            parent->parent->left_child = node;
+            parent->parent()->left_child = node;
           else
-            parent->parent->right_child = node;
+            parent->parent()->right_child = node;
 
-          node->parent = parent->parent;
-          parent->parent = node;
+          node->set_parent(parent->parent());
+          parent->set_parent(node);
 
           rebalance_insert_(parent);
           return;
@@ -612,15 +1072,15 @@ class redblacktree {
       }
 
       node_type *uncle = get_sibling_(parent);
-      if (uncle->color == BLACK) {
-        node->color = RED;
-        parent->color = BLACK;
-        grandparent->color = RED;
+      if (uncle->color() == BLACK) {
+        node->set_color(RED);
+        parent->set_color(BLACK);
+        grandparent->set_color(RED);
         restructure_(node, parent, grandparent);
       } else {
-        parent->color = BLACK;
-        grandparent->color = RED;
-        uncle->color = BLACK;
+        parent->set_color(BLACK);
+        grandparent->set_color(RED);
+        uncle->set_color(BLACK);
         rebalance_insert_(grandparent);
       }
     }
@@ -634,7 +1094,7 @@ class redblacktree {
    * @return node_type* pointer to the sibling of node
    */
   node_type *get_sibling_(node_type *node) {
-    node_type *parent = node->parent;
+    node_type *parent = node->parent();
     if (node == parent->left_child) return parent->right_child;
     return parent->left_child;
   }
@@ -652,7 +1112,7 @@ class redblacktree {
   void restructure_(node_type *a, node_type *b, node_type *c) {
     // relink the sibling of node to uncle
     node_type *sibling = get_sibling_(a);
-    if (!sibling->is_null_node) sibling->parent = c;
+    if (sibling != off_the_end_) sibling->set_parent(c);
     if (is_left_child_(b))
       c->left_child = sibling;
     else
@@ -661,13 +1121,13 @@ class redblacktree {
     // make b the child of grandgrandparent
     if (c == root_) {
       root_ = b;
-      b->parent = off_the_end_;
-    } else if (c == c->parent->left_child) {
-      c->parent->left_child = b;
-      b->parent = c->parent;
+      b->set_parent(off_the_end_);
+    } else if (c == c->parent()->left_child) {
+      c->parent()->left_child = b;
+      b->set_parent(c->parent());
     } else {
-      c->parent->right_child = b;
-      b->parent = c->parent;
+      c->parent()->right_child = b;
+      b->set_parent(c->parent());
     }
     // make a and c the children of b
     make_children_(b, a, c);
@@ -682,15 +1142,15 @@ class redblacktree {
    * @param child2
    */
   void make_children_(node_type *parent, node_type *child1, node_type *child2) {
-    if (key_is_less_(child1->data, parent->data)) {
+    if (key_is_less_(key_of_(child1->data), key_of_(parent->data))) {
       parent->left_child = child1;
       parent->right_child = child2;
     } else {
       parent->left_child = child2;
       parent->right_child = child1;
     }
-    child1->parent = parent;
-    child2->parent = parent;
+    child1->set_parent(parent);
+    child2->set_parent(parent);
   }
 
   /**
@@ -703,28 +1163,28 @@ class redblacktree {
   void rotate_(node_type *node, node_type *parent, node_type *sibling) {
     // make sibling new parent
     if (parent == root_) {
-      sibling->parent = off_the_end_;
+      sibling->set_parent(off_the_end_);
       root_ = sibling;
     } else if (is_left_child_(parent)) {
-      parent->parent->left_child = sibling;
-      sibling->parent = parent->parent;
+      parent->parent()->left_child = sibling;
+      sibling->set_parent(parent->parent());
     } else {
-      parent->parent->right_child = sibling;
-      sibling->parent = parent->parent;
+      parent->parent()->right_child = sibling;
+      sibling->set_parent(parent->parent());
     }
 
     if (parent->left_child == node) {  // changed
       parent->right_child = sibling->left_child;
-      if (!sibling->left_child->is_null_node)
-        sibling->left_child->parent = parent;
+      if (sibling->left_child != off_the_end_)
+        sibling->left_child->set_parent(parent);
       sibling->left_child = parent;
     } else {
       parent->left_child = sibling->right_child;
-      if (!sibling->right_child->is_null_node)
-        sibling->right_child->parent = parent;
+      if (sibling->right_child != off_the_end_)
+        sibling->right_child->set_parent(parent);
       sibling->right_child = parent;
     }
-    parent->parent = sibling;
+    parent->set_parent(sibling);
   }
 
   /**
@@ -735,8 +1195,8 @@ class redblacktree {
    * @return false returns false if the node is the right child of its parent
    */
   bool is_left_child_(node_type *node) {
-    if (node->parent->is_null_node) return false;
-    return node == node->parent->left_child;
+    if (node->parent() == off_the_end_) return false;
+    return node == node->parent()->left_child;
   }
 
   /**
@@ -775,74 +1235,166 @@ class redblacktree {
    */
   void set_last_(node_type *node) {
     last_ = node;
-    off_the_end_->parent = last_;
+    off_the_end_->set_parent(last_);
   }
 
   /**
-   * @brief recursively copies a tree
+   * @brief copies the nodes of other into this empty tree without recursion.
+   * Right subtrees that still have to be copied wait on a fixed array: a red
+   * black tree is at most 2 * log2(n + 1) levels high, so it can't overflow.
+   * Nodes are made in preorder, so every node is allocated right next to its
+   * left child
    *
-   * @param node the root of the tree to copy
-   * @param parent pointer to a parent node to be set for the root node
-   * @return node_type* pointer to the root of the new subtree
+   * @param other a tree with at least one node
    */
-  node_type *copy_subtree_(node_type *node, node_type *parent) {
-    if (node->is_null_node) return off_the_end_;
+  void copy_tree_(const redblacktree &other) {
+    const node_type *pending_src[2 * std::numeric_limits<size_type>::digits];
+    node_type *pending_parent[2 * std::numeric_limits<size_type>::digits];
+    size_type pending = 0;
 
-    node_type *tmp = new_node_(node->data, parent);
-    tmp->color = node->color;
-    tmp->parent = parent;
-    tmp->left_child = copy_subtree_(node->left_child, tmp);
-    tmp->right_child = copy_subtree_(node->right_child, tmp);
+    const node_type *other_end = other.off_the_end_;
+    const node_type *src = other.root_;
+    node_type *parent = off_the_end_;
+    node_type **slot = &root_;
+    for (;;) {
+      node_type *dst = copy_node_(other, src, parent);
+      *slot = dst;
+      if (src->right_child != other_end) {
+        pending_src[pending] = src->right_child;
+        pending_parent[pending++] = dst;
+      }
+      if (src->left_child != other_end) {
+        src = src->left_child;
+        parent = dst;
+        slot = &dst->left_child;
+      } else if (pending) {
+        src = pending_src[--pending];
+        parent = pending_parent[pending];
+        slot = &parent->right_child;
+      } else {
+        return;
+      }
+    }
+  }
 
+  /**
+   * @brief makes a copy of a node of other with the same color. Takes over
+   * first_ and last_ when src is the first or last node of other
+   *
+   * @param other the tree that is copied
+   * @param src the node to copy
+   * @param parent the parent of the new node
+   * @return node_type* pointer to the new node
+   */
+  node_type *copy_node_(const redblacktree &other, const node_type *src,
+                        node_type *parent) {
+    node_type *tmp = new_node_(src->data, parent);
+    tmp->set_color(src->color());
+    if (src == other.first_) first_ = tmp;
+    if (src == other.last_) set_last_(tmp);
     return tmp;
   }
 
   /**
-   * @brief recursively destroys a tree
+   * @brief destroys a tree without recursion. A node with a left child is
+   * rotated right until the smallest node is on top, which is destroyed
+   * before moving on to its right child. Nodes are freed in ascending order
+   * and no parent pointers are touched
    *
    * @param node root of the tree
    */
   void destroy_subtree_(node_type *node) {
-    if (node->is_null_node) return;
-    destroy_subtree_(node->left_child);
-    destroy_subtree_(node->right_child);
-    destroy_node_(node);
-    node = NULL;
+    while (node != off_the_end_) {
+      node_type *left = node->left_child;
+      if (left == off_the_end_) {
+        node_type *right = node->right_child;
+        destroy_node_(node);
+        node = right;
+      } else {
+        node->left_child = left->right_child;
+        left->right_child = node;
+        node = left;
+      }
+    }
   }
 
-  bool key_is_less_(const value_type &element1,
-                    const value_type &element2) const {
-    return cmp_(element1, element2);
+  /**
+   * @brief asks the CPU to load a node into the cache, so a later access
+   * doesn't stall. A no-op on compilers without __builtin_prefetch
+   *
+   * @param node
+   */
+  static void prefetch_(const node_type *node) {
+#ifdef __GNUC__
+    __builtin_prefetch(node);
+#else
+    (void)node;
+#endif
   }
 
-  bool key_is_greater_(const value_type &element1,
-                       const value_type &element2) const {
-    return cmp_(element2, element1);
+  /**
+   * @brief loads both children of a node during a descent while its key is
+   * still being compared, so the next step doesn't wait for memory. This
+   * only pays off once the tree is much larger than the cache and costs a
+   * little on small trees, so it has to be enabled by defining
+   * FT_RBTREE_PREFETCH before including the containers
+   *
+   * @param node the node the descent is at
+   */
+  static void prefetch_children_(const node_type *node) {
+#ifdef FT_RBTREE_PREFETCH
+    prefetch_(node->left_child);
+    prefetch_(node->right_child);
+#else
+    (void)node;
+#endif
   }
 
-  bool key_is_equal_(const value_type &element1,
-                     const value_type &element2) const {
-    return !cmp_(element1, element2) && !cmp_(element2, element1);
+  const key_type &key_of_(const value_type &value) const {
+    return KeyOfValue()(value);
+  }
+
+  bool key_is_less_(const key_type &key1, const key_type &key2) const {
+    return cmp_(key1, key2);
+  }
+
+  bool key_is_greater_(const key_type &key1, const key_type &key2) const {
+    return cmp_(key2, key1);
   }
 
   /**
-   * @brief makes an empty node with an empty data member and pointers to the
-   * off_the_end node
+   * @brief makes the off_the_end node. It is black, its children point to
+   * itself and its parent is last_ (itself while the tree is empty). It lives
+   * as long as the tree and isn't taken from allocator_, so a pooling allocator
+   * can give its blocks back as soon as the last value is erased
    *
-   * @return node_type* pointer to the new node
+   * @return node_type* pointer to the new off_the_end node
    */
-  node_type *new_node_() {
-    node_type *tmp = allocator_.allocate(1);
-    allocator_.construct(tmp, node_type());
-    tmp->is_null_node = true;
-    tmp->left_child = off_the_end_;
-    tmp->right_child = off_the_end_;
-    tmp->parent = off_the_end_;
+  node_type *make_off_the_end_() {
+    std::allocator<node_type> alloc;
+    node_type *tmp = alloc.allocate(1);
+    try {
+      new (static_cast<void *>(tmp)) node_type();
+    } catch (...) {
+      alloc.deallocate(tmp, 1);
+      throw;
+    }
+    tmp->set_color(BLACK);
+    tmp->left_child = tmp;
+    tmp->right_child = tmp;
+    tmp->set_parent(tmp);
     return tmp;
   }
 
+  void destroy_off_the_end_() {
+    off_the_end_->~node_type();
+    std::allocator<node_type>().deallocate(off_the_end_, 1);
+  }
+
   /**
-   * @brief makes a node with a value as data and a parent
+   * @brief makes a node with a value as data and a parent. The node is
+   * constructed in place (allocator_.construct would need a temporary node),
+   * so value is copied exactly once
    *
    * @param value
    * @param parent
@@ -850,20 +1402,28 @@ class redblacktree {
    */
   node_type *new_node_(const value_type &value, node_type *parent) {
     node_type *tmp = allocator_.allocate(1);
-    allocator_.construct(tmp, node_type(value));
-    tmp->is_null_node = false;
+    try {
+      new (static_cast<void *>(tmp)) node_type(value);
+    } catch (...) {
+      allocator_.deallocate(tmp, 1);
+      throw;
+    }
     tmp->left_child = off_the_end_;
     tmp->right_child = off_the_end_;
-    tmp->parent = parent;
+    tmp->set_parent(parent);
     return tmp;
   }
 
   void destroy_node_(node_type *node) {
-    allocator_.destroy(node);
+    node->~node_type();
     allocator_.deallocate(node, 1);
   }
 };
 
+template <class T, class Compare, class Allocator, class KeyOfValue>
+const typename redblacktree<T, Compare, Allocator, KeyOfValue>::size_type
+    redblacktree<T, Compare, Allocator, KeyOfValue>::batch_size_;
+
 }  // namespace ft
 
 #endif  // REDBLACKTREE_H
@@ -7,6 +7,10 @@
 
 namespace ft {
 
+// Defined in frozen_set.hpp, which only callers of set::freeze() include
+template <class Key, class Compare, class Allocator>
+class frozen_set;
+
 template <class Key, class Compare = std::less<Key>,
           class Allocator = std::allocator<Key> >
 class set {
@@ -107,19 +111,18 @@ class set {
   }
 
   iterator insert(iterator pos, const value_type& value) {
-    (void)pos;
-    return iterator(tree_.insert(value).first);
+    return iterator(tree_.insert(pos.node(), value).first);
   }
 
   template <class InputIt>
   void insert(InputIt first, InputIt last) {
-    while (first != last) tree_.insert(*(first++));
+    tree_.insert_range(first, last);
   }
 
-  void erase(iterator pos) { tree_.erase(*pos); }
+  void erase(iterator pos) { tree_.erase(pos.node()); }
 
   void erase(iterator first, iterator last) {
-    while (first != last) tree_.erase(*(first++));
+    tree_.erase(first.node(), last.node());
   }
 
   size_type erase(const Key& key) {
@@ -134,10 +137,7 @@ class set {
   //**************************************************
 
   size_type count(const Key& key) const {
-    (void)key;
-    iterator it1(tree_.find(key));
-    iterator it2(tree_.get_end());
-    if (it1 == it2) return 0;
+    if (tree_.find(key) == tree_.get_end()) return 0;
     return 1;
   }
 
@@ -166,13 +166,73 @@ class set {
     return const_iterator(tree_.upper_bound(key));
   }
 
+  /**
+   * @brief writes find(key) to out for every key in [first;last). The
+   * searches of several keys are interleaved, so their cache misses overlap
+   *
+   * @param first
+   * @param last
+   * @param out receives one iterator per key
+   * @return OutputIt out past the last written iterator
+   */
+  template <class ForwardIt, class OutputIt>
+  OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const {
+    return tree_.template find_batch<const_iterator>(first, last, out);
+  }
+
+  /**
+   * @brief writes lower_bound(key) to out for every key in [first;last), see
+   * find_batch
+   */
+  template <class ForwardIt, class OutputIt>
+  OutputIt lower_bound_batch(ForwardIt first, ForwardIt last,
+                             OutputIt out) const {
+    return tree_.template lower_bound_batch<const_iterator>(first, last, out);
+  }
+
+  /**
+   * @brief find_batch for keys in ascending order. Every search starts at the
+   * result of the previous key, so close keys skip the upper tree levels
+   */
+  template <class ForwardIt, class OutputIt>
+  OutputIt find_batch_sorted(ForwardIt first, ForwardIt last,
+                             OutputIt out) const {
+    return tree_.template find_batch_sorted<const_iterator>(first, last, out);
+  }
+
+  /**
+   * @brief lower_bound_batch for keys in ascending order, see
+   * find_batch_sorted
+   */
+  template <class ForwardIt, class OutputIt>
+  OutputIt lower_bound_batch_sorted(ForwardIt first, ForwardIt last,
+                                    OutputIt out) const {
+    return tree_.template lower_bound_batch_sorted<const_iterator>(first, last,
+                                                                   out);
+  }
+
+  //**************************************************
+  // Snapshot
+  //**************************************************
+
+  /**
+   * @brief Copies the keys into a read-only frozen_set, see map::freeze.
+   * Needs frozen_set.hpp
+   *
+   * @return frozen_set<Key, Compare, Allocator>
+   */
+  frozen_set<Key, Compare, Allocator> freeze() const {
+    return frozen_set<Key, Compare, Allocator>(begin(), size(), key_comp(),
+                                               get_allocator());
+  }
+
   //**************************************************
   // Observers
   //**************************************************
 
-  key_compare key_comp() const { return key_compare(); }
+  key_compare key_comp() const { return tree_.key_comp(); }
 
-  value_compare value_comp() const { return value_compare(key_compare()); }
+  value_compare value_comp() const { return tree_.key_comp(); }
 
  private:
   tree_type tree_;
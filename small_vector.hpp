@@ -0,0 +1,360 @@
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+#include "vector.hpp"
+
+namespace ft {
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::small_buffer_allocator
+//
+// Allocator that hands out one fixed buffer of N objects before it falls back
+// to Allocator. The buffer belongs to the container that created the
+// allocator. Copies share it, which is how the container takes over the
+// allocator it was given, so the container must not hand out such copies:
+// small_vector::get_allocator() returns one without a buffer. Assignments
+// don't take the buffer along, every allocator stays bound to the buffer it
+// was constructed with.
+//////////////////////////////////////////////////////////////////////////////
+
+template <class T, std::size_t N, class Allocator = std::allocator<T> >
+class small_buffer_allocator : public Allocator {
+ public:
+  //**************************************************
+  // Typedefs
+  //**************************************************
+
+  typedef typename Allocator::pointer pointer;
+  typedef typename Allocator::size_type size_type;
+
+  template <class U>
+  struct rebind {
+    typedef small_buffer_allocator<
+        U, N, typename Allocator::template rebind<U>::other>
+        other;
+  };
+
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  small_buffer_allocator() : buffer_(NULL), in_use_(false) {}
+
+  explicit small_buffer_allocator(pointer buffer,
+                                  const Allocator& alloc = Allocator())
+      : Allocator(alloc), buffer_(buffer), in_use_(false) {}
+
+  small_buffer_allocator(const small_buffer_allocator& other)
+      : Allocator(other), buffer_(other.buffer_), in_use_(false) {}
+
+  template <class U, class A>
+  small_buffer_allocator(const small_buffer_allocator<U, N, A>& other)
+      : Allocator(other), buffer_(NULL), in_use_(false) {}
+
+  small_buffer_allocator& operator=(const small_buffer_allocator& other) {
+    Allocator::operator=(other);
+    return *this;
+  }
+
+  //**************************************************
+  // Member functions
+  //**************************************************
+
+  pointer allocate(size_type n) {
+    if (buffer_ && !in_use_ && n <= N) {
+      in_use_ = true;
+      return buffer_;
+    }
+    return Allocator::allocate(n);
+  }
+
+  void deallocate(pointer p, size_type n) {
+    if (p == buffer_)
+      in_use_ = false;
+    else
+      Allocator::deallocate(p, n);
+  }
+
+ private:
+  pointer buffer_;
+  bool in_use_;
+};
+
+template <class T, std::size_t N, class Allocator>
+struct has_default_construct<small_buffer_allocator<T, N, Allocator> >
+    : public has_default_construct<Allocator> {};
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::small_vector
+//
+// vector that keeps up to N objects inside the object itself and only
+// allocates once it grows past that. Apart from swap and moves, which have to
+// move the objects when they live inline, it behaves exactly like ft::vector.
+// Iterators and references are invalidated by swap and moves as well.
+// Built as C++98, T may not need more alignment than long double.
+//////////////////////////////////////////////////////////////////////////////
+
+#if __cplusplus < 201103L && defined(__GNUC__)
+// Only defined for true: T needs more alignment than the buffer gives if
+// small_vector_alignment_check<false> is used
+template <bool AlignmentFits>
+struct small_vector_alignment_check;
+template <>
+struct small_vector_alignment_check<true> {};
+#endif
+
+// The inline buffer, a base class so it exists before the vector is built.
+// C++98 has no zero-sized arrays, so N == 0 still reserves one object's worth.
+// C++98 can't align it for T either: the union only aligns it like the widest
+// fundamental type, and over-aligned types are rejected where the compiler can
+// tell
+template <class T, std::size_t N>
+struct small_vector_storage {
+  union buffer_type {
+#if __cplusplus >= 201103L
+    alignas(T) unsigned char bytes[(N ? N : 1) * sizeof(T)];
+#else
+    unsigned char bytes[(N ? N : 1) * sizeof(T)];
+#endif
+    long double align_long_double;
+    double align_double;
+    long align_long;
+    void* align_pointer;
+  };
+
+  buffer_type storage_;
+
+#if __cplusplus < 201103L && defined(__GNUC__)
+  enum {
+    alignment_check_ = sizeof(small_vector_alignment_check<
+                              __alignof__(T) <= __alignof__(buffer_type)>)
+  };
+#endif
+
+  T* inline_buffer() { return reinterpret_cast<T*>(storage_.bytes); }
+  const T* inline_buffer() const {
+    return reinterpret_cast<const T*>(storage_.bytes);
+  }
+};
+
+template <typename T, std::size_t N, typename Allocator = std::allocator<T>,
+          typename GrowthPolicy = ft::growth_double>
+class small_vector
+    : private small_vector_storage<T, N>,
+      public vector<T, small_buffer_allocator<T, N, Allocator>, GrowthPolicy> {
+  typedef small_vector_storage<T, N> storage_type;
+  typedef vector<T, small_buffer_allocator<T, N, Allocator>, GrowthPolicy>
+      base_type;
+
+ public:
+  typedef typename base_type::value_type value_type;
+  typedef typename base_type::size_type size_type;
+  typedef typename base_type::allocator_type allocator_type;
+  typedef typename base_type::pointer pointer;
+  typedef typename base_type::iterator iterator;
+  typedef typename base_type::const_iterator const_iterator;
+
+  static const size_type inline_capacity = N;
+
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  small_vector() : base_type(make_allocator(*this, Allocator())) {
+    claim_inline();
+  }
+
+  explicit small_vector(const Allocator& alloc)
+      : base_type(make_allocator(*this, alloc)) {
+    claim_inline();
+  }
+
+  explicit small_vector(size_type count,
+                        const value_type& value = value_type(),
+                        const Allocator& alloc = Allocator())
+      : base_type(make_allocator(*this, alloc)) {
+    claim_inline();
+    this->assign(count, value);
+  }
+
+  template <class InputIt>
+  small_vector(
+      InputIt first, InputIt last, const Allocator& alloc = Allocator(),
+      typename ft::enable_if<!std::numeric_limits<InputIt>::is_integer,
+                             InputIt>::type* = 0)
+      : base_type(make_allocator(*this, alloc)) {
+    claim_inline();
+    this->assign(first, last);
+  }
+
+  small_vector(const small_vector& other)
+      : base_type(make_allocator(*this, Allocator())) {
+    claim_inline();
+    this->assign(other.begin(), other.end());
+  }
+
+#if __cplusplus >= 201103L
+  small_vector(small_vector&& other)
+      : base_type(make_allocator(*this, Allocator())) {
+    claim_inline();
+    swap(other);
+  }
+#endif
+
+  ~small_vector() {}
+
+  //**************************************************
+  // Operator overloads
+  //**************************************************
+
+  small_vector& operator=(const small_vector& other) {
+    if (this != &other) this->assign(other.begin(), other.end());
+    return *this;
+  }
+
+#if __cplusplus >= 201103L
+  small_vector& operator=(small_vector&& other) {
+    small_vector tmp(ft::move(other));
+    swap(tmp);
+    return *this;
+  }
+#endif
+
+  //**************************************************
+  // Member functions
+  //**************************************************
+
+  /**
+   * @brief a copy of the allocator without the inline buffer, so allocating
+   * with it can't hand out the buffer the objects live in
+   *
+   * @return allocator_type
+   */
+  allocator_type get_allocator() const {
+    return allocator_type(NULL,
+                          static_cast<const Allocator&>(this->allocator_));
+  }
+
+  /**
+   * @brief true while the objects live inside the small_vector itself
+   *
+   * @return bool
+   */
+  bool is_inline() const { return this->start_ == inline_buffer(); }
+
+  /**
+   * @brief reduces the capacity to the size, but never below N: objects that
+   * fit move back into the inline buffer
+   *
+   */
+  void shrink_to_fit() {
+    size_type size = this->size();
+    if (is_inline() || this->capacity() == size) return;
+    if (size <= N)
+      this->replace_buffer(this->allocator_.allocate(N), N, size, 0);
+    else
+      base_type::shrink_to_fit();
+  }
+
+  /**
+   * @brief shrink_to_fit, but only if more than the fraction max_slack of the
+   * capacity is unused
+   *
+   * @param max_slack between 0 (always shrink) and 1 (never shrink)
+   * @return true if the buffer was reallocated
+   */
+  bool trim(double max_slack = 0.5) {
+    if (is_inline()) return false;
+    size_type slack = this->capacity() - this->size();
+    if (slack == 0 || slack <= max_slack * this->capacity()) return false;
+    shrink_to_fit();
+    return true;
+  }
+
+  /**
+   * @brief Swaps the objects with another small_vector. Heap buffers are
+   * exchanged, objects in an inline buffer have to be moved
+   *
+   * @param other
+   */
+  void swap(small_vector& other) {
+    if (!is_inline() && !other.is_inline())
+      base_type::swap(other);
+    else if (is_inline() && other.is_inline())
+      swap_inline(other);
+    else if (is_inline())
+      other.give_heap_buffer(*this);
+    else
+      give_heap_buffer(other);
+  }
+
+ private:
+  using storage_type::inline_buffer;
+
+  // Static: the vector base doesn't exist yet when this is called
+  static allocator_type make_allocator(storage_type& storage,
+                                       const Allocator& alloc) {
+    return allocator_type(storage.inline_buffer(), alloc);
+  }
+
+  // Starts out with the inline buffer, so the first N objects never allocate
+  void claim_inline() {
+    this->start_ = this->allocator_.allocate(N);
+    this->finish_ = this->start_ + N;
+    this->end_of_storage_ = this->start_;
+  }
+
+  // Both inline: swaps the common part and moves the rest over
+  void swap_inline(small_vector& other) {
+    small_vector& shorter = this->size() < other.size() ? *this : other;
+    small_vector& longer = this->size() < other.size() ? other : *this;
+    size_type common = shorter.size();
+    for (size_type i = 0; i < common; ++i) std::swap(shorter[i], longer[i]);
+    for (size_type i = common; i < longer.size(); ++i)
+      shorter.push_back(ft::move(longer[i]));
+    longer.erase(longer.begin() + common, longer.end());
+  }
+
+  // *this is on the heap, small inline. The objects of small move into the
+  // inline buffer of *this, then small takes over the heap buffer
+  void give_heap_buffer(small_vector& small) {
+    pointer heap_start = this->start_;
+    pointer heap_finish = this->finish_;
+    pointer heap_end = this->end_of_storage_;
+    pointer buffer = this->allocator_.allocate(N);
+    size_type size = small.size();
+    size_type i = 0;
+    try {
+      for (; i < size; ++i) this->construct(buffer + i, ft::move(small[i]));
+    } catch (...) {
+      this->destroy(buffer, buffer + i);
+      this->allocator_.deallocate(buffer, N);
+      throw;
+    }
+    small.clear();
+    small.allocator_.deallocate(small.start_, N);
+    small.start_ = heap_start;
+    small.finish_ = heap_finish;
+    small.end_of_storage_ = heap_end;
+    this->start_ = buffer;
+    this->finish_ = buffer + N;
+    this->end_of_storage_ = buffer + size;
+  }
+};
+
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+const typename small_vector<T, N, Allocator, GrowthPolicy>::size_type
+    small_vector<T, N, Allocator, GrowthPolicy>::inline_capacity;
+
+}  // namespace ft
+
+// std::swap specialization for ft::small_vector
+namespace std {
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+void swap(ft::small_vector<T, N, Allocator, GrowthPolicy>& lhs,
+          ft::small_vector<T, N, Allocator, GrowthPolicy>& rhs) {
+  lhs.swap(rhs);
+}
+}  // namespace std
+
+#endif  // SMALL_VECTOR_H
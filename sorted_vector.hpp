@@ -0,0 +1,535 @@
+#ifndef SORTED_VECTOR_H
+#define SORTED_VECTOR_H
+
+#include "iterator_vector.hpp"
+#include "utilities.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+// How insert_range holds new values while it sorts them. A value is assigned
+// member by member while it is sorted: ft::pair assigns by destroying itself
+// and copying the other pair in, so a throwing copy would leave a destroyed
+// value behind. Keys of map values are const, so they are staged in a
+// std::pair with a mutable key, which can also be moved under C++11
+template <class T, class KeyOfValue>
+struct sorted_vector_staging {
+  typedef T type;
+
+  template <class U>
+  static type stage(const U& value) {
+    return value;
+  }
+  static const T& value(const type& staged) { return staged; }
+  static const typename KeyOfValue::result_type& key(const type& staged) {
+    return KeyOfValue()(staged);
+  }
+};
+
+template <class Key, class T, class KeyOfValue>
+struct sorted_vector_staging<ft::pair<const Key, T>, KeyOfValue> {
+  typedef std::pair<Key, T> type;
+
+  template <class U>
+  static type stage(const U& value) {
+    return type(value.first, value.second);
+  }
+  static ft::pair<const Key, T> value(const type& staged) {
+    return ft::pair<const Key, T>(staged.first, staged.second);
+  }
+  static const Key& key(const type& staged) { return staged.first; }
+};
+
+// The values of flat_map and flat_set, kept sorted by key in one ft::vector.
+// A lookup is a binary search over contiguous memory, there are no nodes and
+// no pointers to follow. In exchange, inserting or erasing a single value
+// shifts all values behind it, so the table is meant to be filled in bulk
+// (insert_range) and then mostly read.
+//
+// Like hashtable, values are addressed by their index: the containers turn
+// indices into iterators. Stores a value_type, KeyOfValue extracts the key
+// that Compare works on.
+template <class T, class Compare, class Allocator = std::allocator<T>,
+          class KeyOfValue = ft::identity<T> >
+class sorted_vector {
+ public:
+  //**************************************************
+  // Typedefs
+  //**************************************************
+
+  typedef typename KeyOfValue::result_type key_type;
+  typedef T value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Compare key_compare;
+  typedef Allocator allocator_type;
+
+  typedef ft::vector<value_type, allocator_type> storage_type;
+  typedef typename storage_type::iterator iterator;
+  typedef typename storage_type::const_iterator const_iterator;
+
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  sorted_vector(const key_compare& comp,
+                const allocator_type& alloc = allocator_type())
+      : values_(alloc), comp_(comp) {}
+
+  sorted_vector(const sorted_vector& other)
+      : values_(other.values_), comp_(other.comp_) {}
+
+  ~sorted_vector() {}
+
+  sorted_vector& operator=(const sorted_vector& other) {
+    values_ = other.values_;
+    comp_ = other.comp_;
+    return *this;
+  }
+
+  //**************************************************
+  // Iterators
+  //**************************************************
+
+  iterator begin() { return values_.begin(); }
+  const_iterator begin() const { return values_.begin(); }
+  iterator end() { return values_.end(); }
+  const_iterator end() const { return values_.end(); }
+
+  iterator iterator_at(size_type index) { return values_.begin() + index; }
+  const_iterator iterator_at(size_type index) const {
+    return values_.begin() + index;
+  }
+
+  size_type index_of(const_iterator pos) const {
+    return pos.base() - values_.data();
+  }
+
+  //**************************************************
+  // Capacity
+  //**************************************************
+
+  size_type size() const { return values_.size(); }
+  size_type max_size() const { return values_.max_size(); }
+  size_type capacity() const { return values_.capacity(); }
+  void reserve(size_type new_cap) { values_.reserve(new_cap); }
+  void shrink_to_fit() { values_.shrink_to_fit(); }
+
+  //**************************************************
+  // Modifiers
+  //**************************************************
+
+  void clear() { values_.clear(); }
+
+  /**
+   * @brief Inserts value if its key is not in the table yet
+   *
+   * @param value
+   * @return ft::pair<size_type, bool> index of the value with the key and
+   * whether it was inserted
+   */
+  ft::pair<size_type, bool> insert(const value_type& value) {
+    ft::pair<size_type, bool> position = find_position(key_of_(value));
+    if (position.second)
+      return ft::pair<size_type, bool>(position.first, false);
+    return ft::pair<size_type, bool>(insert_at(position.first, value), true);
+  }
+
+  /**
+   * @brief Inserts value, searching only the neighbourhood of hint if value
+   * belongs right before it. Appending in ascending order through end() is
+   * thereby a single comparison per value
+   *
+   * @param hint
+   * @param value
+   * @return size_type index of the value with the key
+   */
+  size_type insert(size_type hint, const value_type& value) {
+    const key_type& key = key_of_(value);
+    size_type size = this->size();
+    if ((hint == size || comp_(key, key_at_(hint))) &&
+        (hint == 0 || comp_(key_at_(hint - 1), key)))
+      return insert_at(hint, value);
+    return insert(value).first;
+  }
+
+  /**
+   * @brief Inserts value at index, which must be where find_position() said
+   * its key belongs
+   *
+   * @param index
+   * @param value
+   * @return size_type index
+   */
+  size_type insert_at(size_type index, const value_type& value) {
+    values_.insert(values_.begin() + index, value);
+    return index;
+  }
+
+  /**
+   * @brief Inserts the range [first;last) in one go: the new values are
+   * copied aside, sorted and then merged with the old ones into a new buffer.
+   * n inserts into a table of m values cost O(n log n + m) instead of O(n * m)
+   * for one insert after the other. Sorting is skipped if the range already
+   * is, and a range behind all old values is appended in place.
+   *
+   * Of several values with the same key the first is kept, and an old one
+   * wins over all new ones, like a map inserting them one by one. The values
+   * of the table are only ever copy constructed, never assigned, so if a
+   * comparison or copy throws the table is left unchanged
+   *
+   * @param first
+   * @param last
+   */
+  template <class InputIt>
+  void insert_range(InputIt first, InputIt last) {
+    staged_type staged;
+    for (; first != last; ++first) staged.push_back(staging_::stage(*first));
+    if (staged.empty()) return;
+    sort_unique_(staged);
+
+    size_type old_size = size();
+    if (old_size == 0 ||
+        comp_(key_at_(old_size - 1), staging_::key(staged[0]))) {
+      values_.reserve(old_size + staged.size());
+      try {
+        for (size_type i = 0; i < staged.size(); ++i)
+          values_.push_back(staging_::value(staged[i]));
+      } catch (...) {
+        values_.erase(values_.begin() + old_size, values_.end());
+        throw;
+      }
+      return;
+    }
+    storage_type merged(get_allocator());
+    merged.reserve(old_size + staged.size());
+    merge_(staged, merged);
+    values_.swap(merged);
+  }
+
+  /**
+   * @brief Erases the value at index
+   *
+   * @param index
+   * @return size_type the index of the next value, which is index
+   */
+  size_type erase_at(size_type index) {
+    values_.erase(values_.begin() + index);
+    return index;
+  }
+
+  void erase(size_type first, size_type last) {
+    values_.erase(values_.begin() + first, values_.begin() + last);
+  }
+
+  /**
+   * @brief Erases the value with key
+   *
+   * @param key
+   * @return bool whether there was one
+   */
+  bool erase(const key_type& key) {
+    ft::pair<size_type, bool> position = find_position(key);
+    if (!position.second) return false;
+    erase_at(position.first);
+    return true;
+  }
+
+  void swap(sorted_vector& other) {
+    values_.swap(other.values_);
+    std::swap(comp_, other.comp_);
+  }
+
+  //**************************************************
+  // Lookup
+  //**************************************************
+
+  /**
+   * @brief Index of the first value whose key is not less than key. The
+   * halving loop picks the half with a conditional move instead of a branch,
+   * so a search has no mispredictions and always takes log2(size) steps
+   *
+   * @param key
+   * @return size_type index, size() if there is none
+   */
+  size_type lower_bound(const key_type& key) const {
+    size_type n = size();
+    if (n == 0) return 0;
+    const value_type* base = values_.data();
+    while (n > 1) {
+      size_type half = n / 2;
+      base = comp_(key_of_(base[half]), key) ? base + half : base;
+      n -= half;
+    }
+    return (base - values_.data()) + comp_(key_of_(*base), key);
+  }
+
+  size_type upper_bound(const key_type& key) const {
+    size_type index = lower_bound(key);
+    if (index != size() && !comp_(key, key_at_(index))) ++index;
+    return index;
+  }
+
+  /**
+   * @brief lower_bound for a key that is known not to be less than the key
+   * at from. Looks at from + 1, from + 3, from + 7, ... first and then
+   * searches the last step only, so a key close to from is found in a few
+   * steps (exponential search)
+   *
+   * @param from
+   * @param key
+   * @return size_type index
+   */
+  size_type lower_bound_after(size_type from, const key_type& key) const {
+    size_type size = this->size();
+    size_type step = 1;
+    while (from + step < size && comp_(key_at_(from + step), key)) {
+      from += step + 1;
+      step *= 2;
+    }
+    size_type last = from + step < size ? from + step : size;
+    if (last == from) return from;
+    const value_type* base = values_.data() + from;
+    size_type n = last - from + 1;
+    while (n > 1) {
+      size_type half = n / 2;
+      base = comp_(key_of_(base[half - 1]), key) ? base + half : base;
+      n -= half;
+    }
+    return base - values_.data();
+  }
+
+  /**
+   * @brief Searches key
+   *
+   * @param key
+   * @return ft::pair<size_type, bool> index of the value with key and true,
+   * or where it belongs and false
+   */
+  ft::pair<size_type, bool> find_position(const key_type& key) const {
+    size_type index = lower_bound(key);
+    return ft::pair<size_type, bool>(
+        index, index != size() && !comp_(key, key_at_(index)));
+  }
+
+  // Index of the value with key, size() if there is none
+  size_type find(const key_type& key) const {
+    ft::pair<size_type, bool> position = find_position(key);
+    return position.second ? position.first : size();
+  }
+
+  /**
+   * @brief writes find(key) for every key in [first;last) to out. Every
+   * search takes the same number of halving steps, so batch_size_ of them
+   * run in lock step and their memory accesses overlap instead of waiting for
+   * each other
+   *
+   * @tparam Iterator type written to out, constructed from a value_type*
+   * @param first
+   * @param last
+   * @param out
+   * @return OutputIt out past the last written iterator
+   */
+  template <class Iterator, class ForwardIt, class OutputIt>
+  OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const {
+    return lookup_batch_<Iterator>(first, last, out, true);
+  }
+
+  /**
+   * @brief same as find_batch, but writes the lower bound of every key
+   */
+  template <class Iterator, class ForwardIt, class OutputIt>
+  OutputIt lower_bound_batch(ForwardIt first, ForwardIt last,
+                             OutputIt out) const {
+    return lookup_batch_<Iterator>(first, last, out, false);
+  }
+
+  /**
+   * @brief same as find_batch for keys in ascending order. Each search starts
+   * at the result for the previous key, see lower_bound_after. A key smaller
+   * than the one before it is searched in the whole table
+   */
+  template <class Iterator, class ForwardIt, class OutputIt>
+  OutputIt find_batch_sorted(ForwardIt first, ForwardIt last,
+                             OutputIt out) const {
+    return lookup_sorted_<Iterator>(first, last, out, true);
+  }
+
+  /**
+   * @brief same as find_batch_sorted, but writes the lower bound of every key
+   */
+  template <class Iterator, class ForwardIt, class OutputIt>
+  OutputIt lower_bound_batch_sorted(ForwardIt first, ForwardIt last,
+                                    OutputIt out) const {
+    return lookup_sorted_<Iterator>(first, last, out, false);
+  }
+
+  //**************************************************
+  // Observers
+  //**************************************************
+
+  allocator_type get_allocator() const { return values_.get_allocator(); }
+  key_compare key_comp() const { return comp_; }
+
+ private:
+  const key_type& key_of_(const value_type& value) const {
+    return KeyOfValue()(value);
+  }
+
+  const key_type& key_at_(size_type index) const {
+    return key_of_(values_[index]);
+  }
+
+  // Number of searches run in lock step by the batch lookups
+  static const size_type batch_size_ = 16;
+
+  // The iterator of the value at index, end() for size()
+  template <class Iterator>
+  Iterator make_iterator_(size_type index) const {
+    return Iterator(const_cast<value_type*>(values_.data()) + index);
+  }
+
+  /**
+   * @brief implementation of find_batch and lower_bound_batch: the loop of
+   * lower_bound, once for every key of a batch
+   *
+   * @param exact whether missing keys give end() (find) or their lower bound
+   */
+  template <class Iterator, class ForwardIt, class OutputIt>
+  OutputIt lookup_batch_(ForwardIt first, ForwardIt last, OutputIt out,
+                         bool exact) const {
+    // Iterators, not addresses of the keys: *first may be converted to a
+    // temporary key_type
+    ForwardIt keys[batch_size_];
+    const value_type* bases[batch_size_];
+    const value_type* data = values_.data();
+    size_type size = this->size();
+
+    while (first != last) {
+      size_type count = 0;
+      for (; count < batch_size_ && first != last; ++count, ++first) {
+        keys[count] = first;
+        bases[count] = data;
+      }
+      if (size == 0) {
+        for (size_type i = 0; i < count; ++i)
+          *out++ = make_iterator_<Iterator>(0);
+        continue;
+      }
+      for (size_type n = size; n > 1; n -= n / 2) {
+        size_type half = n / 2;
+        for (size_type i = 0; i < count; ++i)
+          bases[i] = comp_(key_of_(bases[i][half]), *keys[i]) ? bases[i] + half
+                                                              : bases[i];
+      }
+      for (size_type i = 0; i < count; ++i) {
+        size_type index =
+            (bases[i] - data) + comp_(key_of_(*bases[i]), *keys[i]);
+        if (exact && index != size && comp_(*keys[i], key_at_(index)))
+          index = size;
+        *out++ = make_iterator_<Iterator>(index);
+      }
+    }
+    return out;
+  }
+
+  /**
+   * @brief implementation of find_batch_sorted and lower_bound_batch_sorted
+   *
+   * @param exact whether missing keys give end() (find) or their lower bound
+   */
+  template <class Iterator, class ForwardIt, class OutputIt>
+  OutputIt lookup_sorted_(ForwardIt first, ForwardIt last, OutputIt out,
+                          bool exact) const {
+    size_type size = this->size();
+    size_type index = 0;
+    // An iterator, not the address of the key: *first may be converted to a
+    // temporary key_type that is gone by the next element
+    ForwardIt previous = last;
+    for (; first != last; ++first) {
+      const key_type& key = *first;
+      if (previous != last && comp_(key, *previous))
+        index = lower_bound(key);
+      else
+        index = lower_bound_after(index, key);
+      previous = first;
+      if (exact && index != size && comp_(key, key_at_(index)))
+        *out++ = make_iterator_<Iterator>(size);
+      else
+        *out++ = make_iterator_<Iterator>(index);
+    }
+    return out;
+  }
+
+  typedef sorted_vector_staging<value_type, KeyOfValue> staging_;
+  typedef ft::vector<typename staging_::type> staged_type;
+
+  // Orders staged values by key, for the std algorithms
+  class staged_compare_ {
+   public:
+    explicit staged_compare_(const key_compare& comp) : comp_(comp) {}
+    bool operator()(const typename staging_::type& lhs,
+                    const typename staging_::type& rhs) const {
+      return comp_(staging_::key(lhs), staging_::key(rhs));
+    }
+
+   private:
+    key_compare comp_;
+  };
+
+  /**
+   * @brief Sorts the staged values by key, keeping the order of equal keys,
+   * and drops all but the first value of every key
+   *
+   * @param staged
+   */
+  void sort_unique_(staged_type& staged) const {
+    typename staged_type::iterator first = staged.begin();
+    typename staged_type::iterator last = staged.end();
+    staged_compare_ comp(comp_);
+    for (typename staged_type::iterator it = first + 1; it < last; ++it) {
+      if (comp(*it, *(it - 1))) {
+        std::stable_sort(first, last, comp);
+        break;
+      }
+    }
+    typename staged_type::iterator kept = first;
+    for (typename staged_type::iterator it = first + 1; it < last; ++it) {
+      if (comp(*kept, *it)) {
+        ++kept;
+        if (kept != it) *kept = *it;
+      }
+    }
+    staged.erase(kept + 1, last);
+  }
+
+  /**
+   * @brief Copies the values of the table and the staged values into out,
+   * which has room for all of them, ordered by key. Of equal keys only the
+   * old value is copied
+   *
+   * @param staged sorted values with unique keys
+   * @param out
+   */
+  void merge_(const staged_type& staged, storage_type& out) const {
+    size_type i = 0;
+    size_type j = 0;
+    while (i < size() && j < staged.size()) {
+      if (comp_(staging_::key(staged[j]), key_at_(i))) {
+        out.push_back(staging_::value(staged[j++]));
+      } else {
+        if (!comp_(key_at_(i), staging_::key(staged[j]))) ++j;
+        out.push_back(values_[i++]);
+      }
+    }
+    for (; i < size(); ++i) out.push_back(values_[i]);
+    for (; j < staged.size(); ++j) out.push_back(staging_::value(staged[j]));
+  }
+
+  storage_type values_;
+  key_compare comp_;
+};
+
+}  // namespace ft
+
+#endif  // SORTED_VECTOR_H
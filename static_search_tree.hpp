@@ -0,0 +1,396 @@
+#ifndef STATIC_SEARCH_TREE_H
+#define STATIC_SEARCH_TREE_H
+
+#include <climits>
+
+#include "iterator_vector.hpp"
+#include "utilities.hpp"
+
+// The 16 keys of a node are compared at once with AVX2, or with SSE2 for
+// 32-bit keys. Define FT_SEARCH_TREE_NO_SIMD to use the portable loop instead
+#if !defined(FT_SEARCH_TREE_NO_SIMD)
+#if defined(__AVX2__)
+#define FT_SEARCH_TREE_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#define FT_SEARCH_TREE_SSE2
+#include <emmintrin.h>
+#endif
+#endif
+
+namespace ft {
+
+//**************************************************
+// The keys of one node of a static_search_tree, 16 sorted integers. rank()
+// counts the ones less than key, which is also the child to descend into
+//**************************************************
+template <class T, std::size_t Size = sizeof(T),
+          bool Signed = std::numeric_limits<T>::is_signed>
+struct search_tree_node {
+  static const std::size_t width = 16;
+
+  // Portable version, the compiler usually vectorizes it on its own
+  static std::size_t rank(const T* keys, const T& key) {
+    std::size_t rank = 0;
+    for (std::size_t i = 0; i < width; ++i) rank += keys[i] < key;
+    return rank;
+  }
+};
+
+#if defined(FT_SEARCH_TREE_AVX2) || defined(FT_SEARCH_TREE_SSE2)
+// The keys of a node are sorted, so the ones less than key are the low bits
+// of the comparison mask. Counting its trailing 1 bits takes one instruction
+// where a popcount without -mpopcnt takes a dozen
+inline unsigned search_tree_rank(unsigned mask) {
+#ifdef __GNUC__
+  return static_cast<unsigned>(__builtin_ctz(~mask));
+#else
+  unsigned rank = 0;
+  for (; mask & 1; mask >>= 1) ++rank;
+  return rank;
+#endif
+}
+
+// 32-bit keys. The CPU only compares signed integers, unsigned keys get their
+// highest bit flipped first, which keeps their order
+template <class T, bool Signed>
+struct search_tree_node<T, 4, Signed> {
+  static const std::size_t width = 16;
+
+#ifdef FT_SEARCH_TREE_AVX2
+  static std::size_t rank(const T* keys, const T& key) {
+    const __m256i* p = reinterpret_cast<const __m256i*>(keys);
+    __m256i x = _mm256_set1_epi32(flip_(key));
+    __m256i lo = _mm256_loadu_si256(p);
+    __m256i hi = _mm256_loadu_si256(p + 1);
+    if (!Signed) {
+      lo = _mm256_xor_si256(lo, _mm256_set1_epi32(sign_bit_));
+      hi = _mm256_xor_si256(hi, _mm256_set1_epi32(sign_bit_));
+    }
+    // 1 bit of the mask per key less than key
+    __m256 less_lo = _mm256_castsi256_ps(_mm256_cmpgt_epi32(x, lo));
+    __m256 less_hi = _mm256_castsi256_ps(_mm256_cmpgt_epi32(x, hi));
+    return search_tree_rank(
+        static_cast<unsigned>(_mm256_movemask_ps(less_lo)) |
+        static_cast<unsigned>(_mm256_movemask_ps(less_hi)) << 8);
+  }
+#else
+  static std::size_t rank(const T* keys, const T& key) {
+    const __m128i* p = reinterpret_cast<const __m128i*>(keys);
+    __m128i x = _mm_set1_epi32(flip_(key));
+    __m128i less[4];
+    for (int i = 0; i < 4; ++i) {
+      __m128i v = _mm_loadu_si128(p + i);
+      if (!Signed) v = _mm_xor_si128(v, _mm_set1_epi32(sign_bit_));
+      less[i] = _mm_cmpgt_epi32(x, v);
+    }
+    // 1 byte of the mask per key less than key
+    __m128i packed = _mm_packs_epi16(_mm_packs_epi32(less[0], less[1]),
+                                     _mm_packs_epi32(less[2], less[3]));
+    return search_tree_rank(static_cast<unsigned>(_mm_movemask_epi8(packed)));
+  }
+#endif
+
+ private:
+  static const int sign_bit_ = INT_MIN;
+
+  static int flip_(const T& key) {
+    return static_cast<int>(static_cast<unsigned>(key) ^
+                            (Signed ? 0u : static_cast<unsigned>(sign_bit_)));
+  }
+};
+#endif
+
+#if defined(FT_SEARCH_TREE_AVX2) && defined(__LP64__)
+// 64-bit keys, 4 per register. SSE2 has no 64-bit comparison, so without
+// AVX2 they use the portable loop
+template <class T, bool Signed>
+struct search_tree_node<T, 8, Signed> {
+  static const std::size_t width = 16;
+
+  static std::size_t rank(const T* keys, const T& key) {
+    const __m256i* p = reinterpret_cast<const __m256i*>(keys);
+    __m256i x = _mm256_set1_epi64x(flip_(key));
+    unsigned mask = 0;
+    for (int i = 0; i < 4; ++i) {
+      __m256i v = _mm256_loadu_si256(p + i);
+      if (!Signed) v = _mm256_xor_si256(v, _mm256_set1_epi64x(sign_bit_));
+      __m256d less = _mm256_castsi256_pd(_mm256_cmpgt_epi64(x, v));
+      mask |= static_cast<unsigned>(_mm256_movemask_pd(less)) << (4 * i);
+    }
+    return search_tree_rank(mask);
+  }
+
+ private:
+  static const long sign_bit_ = LONG_MIN;
+
+  static long flip_(const T& key) {
+    return static_cast<long>(
+        static_cast<unsigned long>(key) ^
+        (Signed ? 0ul : static_cast<unsigned long>(sign_bit_)));
+  }
+};
+#endif
+
+// A static B+ tree for integer keys (an S+ tree): nodes of 16 keys, one cache
+// line for 32-bit keys, that are compared all at once. A search reads one
+// node per layer, log17(n) nodes, where a binary tree reads log2(n).
+//
+// The layers lie one after the other in one array, the leaves first. The
+// leaves are the keys themselves, sorted and padded to a whole node with the
+// largest value of T, so the array begins with the elements in order. Node k
+// of a layer has 17 children, nodes 17k to 17k + 16 of the layer below, and
+// its key i is the smallest key below child i + 1. The number of keys of a
+// node less than key is the child whose subtree holds the lower bound, or
+// whose last key precedes it. Since the leaves are contiguous, both cases are
+// the same index.
+//
+// Built in O(n) from a range that is sorted and free of duplicates, like the
+// elements of a set. Indices are positions in key order, size() is end().
+// Only for integral T compared with std::less, see frozen_set.
+template <class T, class Compare = std::less<T>,
+          class Allocator = std::allocator<T> >
+class static_search_tree {
+ public:
+  //**************************************************
+  // Typedefs
+  //**************************************************
+
+  typedef T key_type;
+  typedef T value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Compare key_compare;
+  typedef Allocator allocator_type;
+  typedef typename Allocator::pointer pointer;
+
+  typedef Iterator_vector<const value_type> const_iterator;
+
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  static_search_tree(const key_compare& comp,
+                     const allocator_type& alloc = allocator_type())
+      : allocator_(alloc),
+        comp_(comp),
+        buffer_(NULL),
+        values_(NULL),
+        capacity_(0),
+        size_(0),
+        height_(0) {}
+
+  /**
+   * @brief Builds the tree from the n keys starting at first, which must be
+   * sorted and have no two equal keys
+   *
+   * @param first
+   * @param n
+   * @param comp
+   * @param alloc
+   */
+  template <class InputIt>
+  static_search_tree(InputIt first, size_type n, const key_compare& comp,
+                     const allocator_type& alloc = allocator_type())
+      : allocator_(alloc),
+        comp_(comp),
+        buffer_(NULL),
+        values_(NULL),
+        capacity_(0),
+        size_(0),
+        height_(0) {
+    if (n == 0) return;
+    allocate_(n);
+    try {
+      for (size_type i = 0; i < n; ++i, ++first)
+        allocator_.construct(values_ + i, *first);
+    } catch (...) {
+      deallocate_();
+      throw;
+    }
+    size_ = n;
+    build_();
+  }
+
+  static_search_tree(const static_search_tree& other)
+      : allocator_(other.allocator_),
+        comp_(other.comp_),
+        buffer_(NULL),
+        values_(NULL),
+        capacity_(0),
+        size_(0),
+        height_(0) {
+    if (other.size_ == 0) return;
+    allocate_(other.size_);
+    size_ = other.size_;
+    std::copy(other.values_, other.values_ + offsets_[height_], values_);
+  }
+
+  // Integers, nothing to destroy
+  ~static_search_tree() { deallocate_(); }
+
+  static_search_tree& operator=(const static_search_tree& other) {
+    if (this != &other) {
+      static_search_tree tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  //**************************************************
+  // Iterators
+  //**************************************************
+
+  const_iterator begin() const { return iterator_at(0); }
+  const_iterator end() const { return iterator_at(size_); }
+
+  const_iterator iterator_at(size_type index) const {
+    return const_iterator(values_ + index);
+  }
+
+  //**************************************************
+  // Capacity
+  //**************************************************
+
+  size_type size() const { return size_; }
+  size_type max_size() const { return allocator_.max_size() / 2; }
+
+  //**************************************************
+  // Modifiers
+  //**************************************************
+
+  void swap(static_search_tree& other) {
+    std::swap(allocator_, other.allocator_);
+    std::swap(comp_, other.comp_);
+    std::swap(buffer_, other.buffer_);
+    std::swap(values_, other.values_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(height_, other.height_);
+    std::swap_ranges(offsets_, offsets_ + max_height_ + 1, other.offsets_);
+  }
+
+  //**************************************************
+  // Lookup
+  //**************************************************
+
+  /**
+   * @brief Index of the first key not less than key, found by descending
+   * through one node per layer
+   *
+   * @param key
+   * @return size_type index, size() (end) if there is none
+   */
+  size_type lower_bound(const key_type& key) const {
+    if (size_ == 0) return 0;
+    size_type k = 0;
+    for (size_type h = height_ - 1; h > 0; --h)
+      k = k * (width_ + 1) + node_type::rank(node_(h, k), key);
+    return k * width_ + node_type::rank(node_(0, k), key);
+  }
+
+  // Index of the first key greater than key, size() if there is none
+  size_type upper_bound(const key_type& key) const {
+    if (key == std::numeric_limits<key_type>::max()) return size_;
+    return lower_bound(static_cast<key_type>(key + 1));
+  }
+
+  // Index of key, size() if there is none
+  size_type find(const key_type& key) const {
+    size_type k = lower_bound(key);
+    if (k == size_ || key < values_[k]) return size_;
+    return k;
+  }
+
+  //**************************************************
+  // Observers
+  //**************************************************
+
+  allocator_type get_allocator() const { return allocator_; }
+  key_compare key_comp() const { return comp_; }
+
+ private:
+  typedef search_tree_node<T> node_type;
+
+  static const size_type width_ = node_type::width;
+  static const size_type cache_line_ = 64;
+
+  // Each layer has a 17th of the nodes of the one below, so that is enough
+  // layers for any size_type
+  static const size_type max_height_ = sizeof(size_type) * 2 + 1;
+
+  // Nodes needed for n keys
+  static size_type nodes_(size_type n) { return (n + width_ - 1) / width_; }
+
+  // Keys of the layer above a layer with n keys, one per node but the first
+  static size_type parent_keys_(size_type n) {
+    return (nodes_(n) + width_) / (width_ + 1) * width_;
+  }
+
+  const value_type* node_(size_type layer, size_type k) const {
+    return values_ + offsets_[layer] + k * width_;
+  }
+
+  /**
+   * @brief Computes the layers for n keys and allocates room for them, with
+   * the first node at the start of a cache line. The buffer has one line
+   * more than needed to make room for the shift
+   *
+   * @param n
+   */
+  void allocate_(size_type n) {
+    height_ = 0;
+    offsets_[0] = 0;
+    for (size_type keys = n;; keys = parent_keys_(keys)) {
+      offsets_[height_ + 1] = offsets_[height_] + nodes_(keys) * width_;
+      ++height_;
+      if (keys <= width_) break;
+    }
+    size_type slack = cache_line_ / sizeof(T) + 1;
+    capacity_ = offsets_[height_] + slack;
+    buffer_ = allocator_.allocate(capacity_);
+    std::size_t address = reinterpret_cast<std::size_t>(&*buffer_);
+    std::size_t shift = (cache_line_ - address % cache_line_) % cache_line_;
+    values_ = buffer_;
+    if (shift % sizeof(T) == 0) values_ += shift / sizeof(T);
+  }
+
+  void deallocate_() {
+    if (buffer_) allocator_.deallocate(buffer_, capacity_);
+    buffer_ = NULL;
+    values_ = NULL;
+    capacity_ = 0;
+    size_ = 0;
+    height_ = 0;
+  }
+
+  // Pads the leaves and fills the layers above them, from the bottom
+  void build_() {
+    const value_type padding = std::numeric_limits<value_type>::max();
+    for (size_type i = size_; i < offsets_[1]; ++i)
+      allocator_.construct(values_ + i, padding);
+    for (size_type h = 1; h < height_; ++h) {
+      for (size_type i = 0; i < offsets_[h + 1] - offsets_[h]; ++i) {
+        // First leaf below child i % 16 + 1 of node i / 16
+        size_type k = i / width_ * (width_ + 1) + i % width_ + 1;
+        for (size_type l = 1; l < h; ++l) k *= width_ + 1;
+        k *= width_;
+        allocator_.construct(values_ + offsets_[h] + i,
+                             k < size_ ? values_[k] : padding);
+      }
+    }
+  }
+
+  allocator_type allocator_;
+  key_compare comp_;
+  pointer buffer_;
+  pointer values_;
+  size_type capacity_;
+  size_type size_;
+  size_type height_;
+  size_type offsets_[max_height_ + 1];  // Start of each layer, then the end
+};
+
+}  // namespace ft
+
+#endif  // STATIC_SEARCH_TREE_H
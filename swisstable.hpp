@@ -0,0 +1,697 @@
+#ifndef SWISSTABLE_H
+#define SWISSTABLE_H
+
+#include <cstring>
+
+#include "iterator_hashtable.hpp"
+#include "utilities.hpp"
+
+// The control bytes of 16 slots are compared at once with SSE2. Define
+// FT_SWISSTABLE_NO_SSE2 to use the portable loop instead
+#if defined(__SSE2__) && !defined(FT_SWISSTABLE_NO_SSE2)
+#define FT_SWISSTABLE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace ft {
+
+//**************************************************
+// The control bytes of 16 consecutive slots of a swisstable. Every match
+// returns a bit mask, bit i stands for the i-th slot of the group
+//**************************************************
+class swiss_group {
+ public:
+  static const std::size_t width = 16;
+
+#ifdef FT_SWISSTABLE_SSE2
+  explicit swiss_group(const unsigned char* ctrl)
+      : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+  // Full slots that hold h2
+  unsigned match(unsigned char h2) const {
+    return _mm_movemask_epi8(
+        _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(h2)), ctrl_));
+  }
+
+  unsigned match_empty() const { return match(SLOT_EMPTY); }
+
+  // SLOT_EMPTY and SLOT_DELETED are the only bytes below SLOT_END as signed
+  // char, SLOT_END itself is -1
+  unsigned match_empty_or_deleted() const {
+    return _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl_));
+  }
+
+ private:
+  __m128i ctrl_;
+#else
+  // Portable version: 8 (or 4) control bytes per size_t, compared with
+  // integer arithmetic
+  explicit swiss_group(const unsigned char* ctrl) {
+    std::memcpy(words_, ctrl, width);
+  }
+
+  // Can also report the byte after a match if it holds h2 ^ 1, a full slot
+  // whose key comparison fails
+  unsigned match(unsigned char h2) const {
+    unsigned mask = 0;
+    for (std::size_t i = 0; i < words; ++i) {
+      std::size_t x = words_[i] ^ (lsbs() * h2);
+      mask |= to_bits_((x - lsbs()) & ~x & msbs()) << (i * sizeof(x));
+    }
+    return mask;
+  }
+
+  // Highest bit set and bit 1 clear: only SLOT_EMPTY
+  unsigned match_empty() const {
+    unsigned mask = 0;
+    for (std::size_t i = 0; i < words; ++i)
+      mask |= to_bits_(words_[i] & ~(words_[i] << 6) & msbs())
+              << (i * sizeof(std::size_t));
+    return mask;
+  }
+
+  // Highest bit set and bit 0 clear: SLOT_EMPTY and SLOT_DELETED
+  unsigned match_empty_or_deleted() const {
+    unsigned mask = 0;
+    for (std::size_t i = 0; i < words; ++i)
+      mask |= to_bits_(words_[i] & ~(words_[i] << 7) & msbs())
+              << (i * sizeof(std::size_t));
+    return mask;
+  }
+
+ private:
+  static const std::size_t words = width / sizeof(std::size_t);
+
+  static std::size_t lsbs() { return ~static_cast<std::size_t>(0) / 0xFF; }
+  static std::size_t msbs() { return lsbs() << 7; }
+
+  // One bit per byte of a word of highest bits, byte i of memory is bit i
+  static unsigned to_bits_(std::size_t bytes) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if (sizeof(std::size_t) == 8) {
+      // Moves the bits at 8 * i + 7 to 56 + i without overlapping carries
+      const std::size_t gather =
+          (static_cast<std::size_t>(0x01020408U) << 16 << 16) | 0x10204080U;
+      return static_cast<unsigned>(((bytes >> 7) * gather) >>
+                                   (8 * sizeof(std::size_t) - 8));
+    }
+#endif
+    const unsigned char* byte = reinterpret_cast<const unsigned char*>(&bytes);
+    unsigned mask = 0;
+    for (std::size_t i = 0; i < sizeof(bytes); ++i)
+      mask |= static_cast<unsigned>(byte[i] >> 7) << i;
+    return mask;
+  }
+
+  std::size_t words_[words];
+#endif
+};
+
+// Index of the lowest set bit, mask must not be 0
+inline unsigned lowest_bit(unsigned mask) {
+#ifdef __GNUC__
+  return __builtin_ctz(mask);
+#else
+  unsigned i = 0;
+  while (!(mask & 1)) {
+    mask >>= 1;
+    ++i;
+  }
+  return i;
+#endif
+}
+
+// Number of zero bits above the highest set bit of a group mask, mask must
+// not be 0
+inline unsigned leading_zeros_16(unsigned mask) {
+  unsigned i = 0;
+  while (!(mask & 0x8000)) {
+    mask <<= 1;
+    ++i;
+  }
+  return i;
+}
+
+// A hash table in the layout of Google's Swiss tables. Every slot has a
+// control byte: SLOT_EMPTY, SLOT_DELETED or, if it's full, the lowest 7 bits
+// of the hash (h2). The rest of the hash (h1) picks the group of 16 slots a
+// probe starts at. A lookup compares h2 against the 16 control bytes of a
+// group at once and only compares keys where they match, then moves on to the
+// next group until a group has an empty slot. With 7 bits of hash a wrong
+// match is rare, so most lookups compare one key and touch two cache lines,
+// even at a load of 7/8.
+//
+// The control bytes are followed by SLOT_END and a copy of the first 15
+// bytes, so a group can start at any slot. The capacity is a power of two
+// minus one, index + i wraps around with & capacity.
+//
+// Same interface as hashtable, see there.
+template <class T, class Hash, class KeyEqual,
+          class Allocator = std::allocator<T>,
+          class KeyOfValue = ft::identity<T> >
+class swisstable {
+ public:
+  //**************************************************
+  // Typedefs
+  //**************************************************
+
+  typedef typename KeyOfValue::result_type key_type;
+  typedef T value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Hash hasher;
+  typedef KeyEqual key_equal;
+  typedef Allocator allocator_type;
+
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef typename Allocator::pointer pointer;
+  typedef typename Allocator::const_pointer const_pointer;
+
+  typedef iterator_hash<value_type> iterator;
+  typedef iterator_hash<const value_type> const_iterator;
+
+ private:
+  typedef typename Allocator::template rebind<unsigned char>::other
+      ctrl_allocator;
+
+ public:
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  swisstable(size_type bucket_count, const hasher& hash,
+             const key_equal& equal,
+             const allocator_type& alloc = allocator_type())
+      : allocator_(alloc),
+        hash_(hash),
+        equal_(equal),
+        slots_(NULL),
+        ctrl_(NULL),
+        capacity_(0),
+        seed_(reinterpret_cast<std::size_t>(this)),
+        size_(0),
+        growth_left_(0),
+        first_(0),
+        max_load_factor_(0.875f) {
+    if (bucket_count) rehash(bucket_count);
+  }
+
+  /**
+   * @brief Copy constructor. The copy has the same capacity and every value
+   * stays in its slot, so nothing has to be hashed
+   *
+   * @param other
+   */
+  swisstable(const swisstable& other)
+      : allocator_(other.allocator_),
+        hash_(other.hash_),
+        equal_(other.equal_),
+        slots_(NULL),
+        ctrl_(NULL),
+        capacity_(0),
+        seed_(other.seed_),
+        size_(0),
+        growth_left_(0),
+        first_(0),
+        max_load_factor_(other.max_load_factor_) {
+    if (other.capacity_ == 0) return;
+    allocate_(other.capacity_);
+    std::memcpy(ctrl_, other.ctrl_, ctrl_bytes_(capacity_));
+    first_ = other.first_;
+    size_type i = first_;
+    try {
+      for (; i < capacity_; ++i)
+        if (is_full_(ctrl_[i]))
+          allocator_.construct(slots_ + i, other.slots_[i]);
+    } catch (...) {
+      // Only the slots before i hold objects
+      std::memset(ctrl_ + i, SLOT_EMPTY, capacity_ - i);
+      destroy_all_();
+      deallocate_();
+      throw;
+    }
+    size_ = other.size_;
+    growth_left_ = other.growth_left_;
+  }
+
+  ~swisstable() {
+    destroy_all_();
+    deallocate_();
+  }
+
+  //**************************************************
+  // Operator overloads
+  //**************************************************
+
+  swisstable& operator=(const swisstable& other) {
+    if (this != &other) {
+      swisstable tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  //**************************************************
+  // Iterators
+  //**************************************************
+
+  iterator begin() { return iterator_at(first_full_()); }
+  const_iterator begin() const { return iterator_at(first_full_()); }
+  iterator end() { return iterator_at(capacity_); }
+  const_iterator end() const { return iterator_at(capacity_); }
+
+  iterator iterator_at(size_type index) {
+    return iterator(slots_ + index, ctrl_ + index);
+  }
+  const_iterator iterator_at(size_type index) const {
+    return const_iterator(slots_ + index, ctrl_ + index);
+  }
+
+  // Slot of the value it points to, capacity for end()
+  size_type index_of(const_iterator it) const { return it.base() - slots_; }
+
+  //**************************************************
+  // Capacity
+  //**************************************************
+
+  size_type size() const { return size_; }
+  size_type max_size() const { return allocator_.max_size(); }
+
+  //**************************************************
+  // Modifiers
+  //**************************************************
+
+  /**
+   * @brief Inserts a value if there is none with the same key yet
+   *
+   * @param value
+   * @return ft::pair<size_type, bool> slot of the value with the key and
+   * whether it was inserted
+   */
+  ft::pair<size_type, bool> insert(const value_type& value) {
+    ft::pair<size_type, bool> position = find_position(key_of_(value));
+    if (position.second)
+      return ft::pair<size_type, bool>(position.first, false);
+    return ft::pair<size_type, bool>(insert_at(position.first, value), true);
+  }
+
+  template <class InputIt>
+  void insert_range(InputIt first, InputIt last) {
+    for (; first != last; ++first) insert(*first);
+  }
+
+  /**
+   * @brief Looks for the value with key, one group of slots at a time
+   *
+   * @param key
+   * @return ft::pair<size_type, bool> the slot of the value with key and true
+   * if there is one. Otherwise the slot a value with key would go to and false
+   */
+  ft::pair<size_type, bool> find_position(const key_type& key) const {
+    if (capacity_ == 0) return ft::pair<size_type, bool>(0, false);
+    std::size_t hash = mix_(hash_(key));
+    unsigned char h2 = h2_(hash);
+    size_type index = h1_(hash);
+    size_type offset = 0;
+    size_type target = capacity_;
+    while (true) {
+      swiss_group group(ctrl_ + index);
+      for (unsigned mask = group.match(h2); mask; mask &= mask - 1) {
+        size_type candidate = (index + lowest_bit(mask)) & capacity_;
+        if (equal_(key_of_(slots_[candidate]), key))
+          return ft::pair<size_type, bool>(candidate, true);
+      }
+      if (target == capacity_) {
+        unsigned free = group.match_empty_or_deleted();
+        if (free) target = (index + lowest_bit(free)) & capacity_;
+      }
+      if (group.match_empty()) return ft::pair<size_type, bool>(target, false);
+      offset += swiss_group::width;
+      index = (index + offset) & capacity_;
+    }
+  }
+
+  /**
+   * @brief Inserts value at a slot without searching for its key again. If the
+   * table has to grow first, the value goes to a new slot
+   *
+   * @param index the slot returned by find_position for the key of value
+   * @param value
+   * @return size_type the slot of the new value
+   */
+  size_type insert_at(size_type index, const value_type& value) {
+    std::size_t hash = mix_(hash_(key_of_(value)));
+    if (capacity_ == 0 || (ctrl_[index] == SLOT_EMPTY && growth_left_ == 0)) {
+      make_room_();
+      index = free_slot_(hash);
+    }
+    allocator_.construct(slots_ + index, value);
+    if (ctrl_[index] == SLOT_EMPTY) --growth_left_;
+    set_ctrl_(index, h2_(hash));
+    ++size_;
+    if (index < first_) first_ = index;
+    return index;
+  }
+
+  /**
+   * @brief Erases the value an iterator points to
+   *
+   * @param index a full slot
+   * @return size_type the next full slot, capacity if there is none
+   */
+  size_type erase_at(size_type index) {
+    size_type next = index_of(++iterator_at(index));
+    // Catches first_ up, so erasing from begin() over and over doesn't walk
+    // the slots emptied before again
+    first_ = first_full_();
+    if (first_ == index) first_ = next;
+    destroy_slot_(index);
+    return next;
+  }
+
+  bool erase(const key_type& key) {
+    ft::pair<size_type, bool> position = find_position(key);
+    if (!position.second) return false;
+    destroy_slot_(position.first);
+    return true;
+  }
+
+  void erase(size_type first, size_type last) {
+    while (first != last) first = erase_at(first);
+  }
+
+  /**
+   * @brief Destroys all values, the capacity stays
+   *
+   */
+  void clear() {
+    if (capacity_ == 0) return;
+    destroy_all_();
+    reset_ctrl_();
+    size_ = 0;
+    growth_left_ = limit_for_(capacity_);
+    first_ = capacity_;
+  }
+
+  void swap(swisstable& other) {
+    std::swap(allocator_, other.allocator_);
+    std::swap(hash_, other.hash_);
+    std::swap(equal_, other.equal_);
+    std::swap(slots_, other.slots_);
+    std::swap(ctrl_, other.ctrl_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(seed_, other.seed_);
+    std::swap(size_, other.size_);
+    std::swap(growth_left_, other.growth_left_);
+    std::swap(first_, other.first_);
+    std::swap(max_load_factor_, other.max_load_factor_);
+  }
+
+  //**************************************************
+  // Lookup
+  //**************************************************
+
+  // Slot of the value with key, capacity if there is none
+  size_type find(const key_type& key) const {
+    if (capacity_ == 0) return capacity_;
+    std::size_t hash = mix_(hash_(key));
+    unsigned char h2 = h2_(hash);
+    size_type index = h1_(hash);
+    size_type offset = 0;
+    while (true) {
+      swiss_group group(ctrl_ + index);
+      for (unsigned mask = group.match(h2); mask; mask &= mask - 1) {
+        size_type candidate = (index + lowest_bit(mask)) & capacity_;
+        if (equal_(key_of_(slots_[candidate]), key)) return candidate;
+      }
+      if (group.match_empty()) return capacity_;
+      offset += swiss_group::width;
+      index = (index + offset) & capacity_;
+    }
+  }
+
+  //**************************************************
+  // Hash policy
+  //**************************************************
+
+  size_type bucket_count() const { return capacity_; }
+
+  float load_factor() const {
+    return capacity_ ? static_cast<float>(size_) / capacity_ : 0.0f;
+  }
+
+  float max_load_factor() const { return max_load_factor_; }
+
+  /**
+   * @brief Sets the load (values and tombstones per slot) at which the table
+   * grows. Kept in (0; 0.875], a probe needs empty slots to end
+   *
+   * @param ml
+   */
+  void max_load_factor(float ml) {
+    if (!(ml > 0.0f)) ml = 0.875f;
+    if (ml > 0.875f) ml = 0.875f;
+    if (capacity_ == 0) {
+      max_load_factor_ = ml;
+      return;
+    }
+    size_type used = limit_for_(capacity_) - growth_left_;
+    max_load_factor_ = ml;
+    if (used > limit_for_(capacity_))
+      rehash_to_(capacity_for_(size_));
+    else
+      growth_left_ = limit_for_(capacity_) - used;
+  }
+
+  /**
+   * @brief Rebuilds the table with at least count slots, and at least as many
+   * as the values need. Drops all tombstones
+   *
+   * @param count
+   */
+  void rehash(size_type count) {
+    size_type capacity = capacity_for_(size_);
+    while (capacity < count) {
+      if (capacity > max_size() / 2)
+        throw std::length_error("rehash count exceeded max_size()");
+      capacity = 2 * capacity + 1;
+    }
+    rehash_to_(capacity);
+  }
+
+  /**
+   * @brief Makes room for count values, so inserting them doesn't rehash
+   *
+   * @param count
+   */
+  void reserve(size_type count) {
+    size_type capacity = capacity_for_(count);
+    if (capacity > capacity_) rehash_to_(capacity);
+  }
+
+  //**************************************************
+  // Observers
+  //**************************************************
+
+  hasher hash_function() const { return hash_; }
+  key_equal key_eq() const { return equal_; }
+  allocator_type get_allocator() const { return allocator_; }
+
+ private:
+  //**************************************************
+  // Member objects
+  //**************************************************
+
+  allocator_type allocator_;
+  hasher hash_;
+  key_equal equal_;
+  pointer slots_;
+  unsigned char* ctrl_;      // see ctrl_bytes_()
+  size_type capacity_;       // 0 or a power of two minus one
+  std::size_t seed_;         // mixed into every hash, see mix_()
+  size_type size_;           // full slots
+  size_type growth_left_;    // empty slots that may still be filled
+  size_type first_;          // at or before the first full slot
+  float max_load_factor_;
+
+  //**************************************************
+  // Private member functions
+  //**************************************************
+
+  static size_type min_capacity_() { return swiss_group::width - 1; }
+
+  // The slots, SLOT_END and the copy of the first group minus one byte
+  static size_type ctrl_bytes_(size_type capacity) {
+    return capacity + swiss_group::width;
+  }
+
+  static bool is_full_(unsigned char ctrl) { return ctrl < SLOT_EMPTY; }
+
+  // Seeded Fibonacci hashing like hashtable::home_(), the seed keeps every
+  // table's iteration order its own
+  std::size_t mix_(std::size_t hash) const {
+    const std::size_t golden =
+        sizeof(std::size_t) > 4
+            ? (static_cast<std::size_t>(0x9E3779B9U) << 16 << 16) | 0x7F4A7C15U
+            : static_cast<std::size_t>(0x9E3779B9U);
+    hash = (hash ^ seed_) * golden;
+    return (hash ^ (hash >> (std::numeric_limits<std::size_t>::digits / 2))) *
+           golden;
+  }
+
+  size_type h1_(std::size_t hash) const { return (hash >> 7) & capacity_; }
+  static unsigned char h2_(std::size_t hash) { return hash & 0x7F; }
+
+  size_type limit_for_(size_type capacity) const {
+    size_type limit = static_cast<size_type>(capacity * max_load_factor_);
+    return limit < capacity ? limit : capacity - 1;
+  }
+
+  // Smallest capacity that holds count values without growing
+  size_type capacity_for_(size_type count) const {
+    size_type capacity = min_capacity_();
+    while (limit_for_(capacity) < count) {
+      if (capacity > max_size() / 2)
+        throw std::length_error("count of values exceeded max_size()");
+      capacity = 2 * capacity + 1;
+    }
+    return capacity;
+  }
+
+  // The first full slot, capacity_ if there is none. Only inserts move first_
+  // back, an erase by key leaves it behind, so begin() skips forward from it
+  size_type first_full_() const {
+    if (size_ == 0) return capacity_;
+    const_iterator it = iterator_at(first_);
+    if (!is_full_(ctrl_[first_])) ++it;
+    return index_of(it);
+  }
+
+  /**
+   * @brief Destroys the value in a slot. Its slot becomes a tombstone, unless
+   * no probe can have passed it: then there is an empty slot within less than
+   * a group around it, and every group containing the slot has one
+   *
+   * @param index a full slot
+   */
+  void destroy_slot_(size_type index) {
+    allocator_.destroy(slots_ + index);
+    --size_;
+    unsigned empty_after = swiss_group(ctrl_ + index).match_empty();
+    unsigned empty_before =
+        swiss_group(ctrl_ + ((index - swiss_group::width) & capacity_))
+            .match_empty();
+    if (empty_before && empty_after &&
+        lowest_bit(empty_after) + leading_zeros_16(empty_before) <
+            swiss_group::width) {
+      set_ctrl_(index, SLOT_EMPTY);
+      ++growth_left_;
+    } else {
+      set_ctrl_(index, SLOT_DELETED);
+    }
+  }
+
+  // Writes the control byte of a slot and its copy behind SLOT_END. Slots
+  // from the first group are at index + capacity + 1, all others just write
+  // their own byte twice
+  void set_ctrl_(size_type index, unsigned char ctrl) {
+    ctrl_[index] = ctrl;
+    ctrl_[((index - (swiss_group::width - 1)) & capacity_) +
+          (swiss_group::width - 1)] = ctrl;
+  }
+
+  void reset_ctrl_() {
+    std::memset(ctrl_, SLOT_EMPTY, ctrl_bytes_(capacity_));
+    ctrl_[capacity_] = SLOT_END;
+  }
+
+  // First empty or deleted slot of the probe sequence of hash, for keys known
+  // to be absent
+  size_type free_slot_(std::size_t hash) const {
+    size_type index = h1_(hash);
+    size_type offset = 0;
+    while (true) {
+      unsigned free = swiss_group(ctrl_ + index).match_empty_or_deleted();
+      if (free) return (index + lowest_bit(free)) & capacity_;
+      offset += swiss_group::width;
+      index = (index + offset) & capacity_;
+    }
+  }
+
+  // Called when one more value doesn't fit. If the values themselves are
+  // below half the limit, it's the tombstones that fill the table, and a
+  // rehash at the same capacity drops them. Otherwise the table doubles
+  void make_room_() {
+    size_type capacity = capacity_for_(size_ + 1);
+    if (capacity <= capacity_)
+      capacity = 2 * (size_ + 1) > limit_for_(capacity_) ? 2 * capacity_ + 1
+                                                         : capacity_;
+    rehash_to_(capacity);
+  }
+
+  /**
+   * @brief Moves all values into a new table of capacity slots. If a value
+   * can't be moved (or copied) the old table is left as it was
+   *
+   * @param capacity a power of two minus one, big enough for all values
+   */
+  void rehash_to_(size_type capacity) {
+    swisstable tmp(0, hash_, equal_, allocator_);
+    tmp.seed_ = seed_;
+    tmp.max_load_factor_ = max_load_factor_;
+    tmp.allocate_(capacity);
+    for (size_type i = first_; i < capacity_; ++i) {
+      if (!is_full_(ctrl_[i])) continue;
+      std::size_t hash = mix_(hash_(key_of_(slots_[i])));
+      size_type index = tmp.free_slot_(hash);
+      tmp.allocator_.construct(tmp.slots_ + index,
+                               ft::move_if_noexcept(slots_[i]));
+      tmp.set_ctrl_(index, h2_(hash));
+      ++tmp.size_;
+      if (index < tmp.first_) tmp.first_ = index;
+    }
+    tmp.growth_left_ -= tmp.size_;
+    swap(tmp);
+  }
+
+  // Allocates capacity empty slots, first_ is set to the end
+  void allocate_(size_type capacity) {
+    ctrl_allocator ctrl_alloc(allocator_);
+    unsigned char* ctrl = ctrl_alloc.allocate(ctrl_bytes_(capacity));
+    try {
+      slots_ = allocator_.allocate(capacity);
+    } catch (...) {
+      ctrl_alloc.deallocate(ctrl, ctrl_bytes_(capacity));
+      throw;
+    }
+    ctrl_ = ctrl;
+    capacity_ = capacity;
+    reset_ctrl_();
+    growth_left_ = limit_for_(capacity_);
+    first_ = capacity_;
+  }
+
+  void deallocate_() {
+    if (capacity_ == 0) return;
+    allocator_.deallocate(slots_, capacity_);
+    ctrl_allocator(allocator_).deallocate(ctrl_, ctrl_bytes_(capacity_));
+    slots_ = NULL;
+    ctrl_ = NULL;
+    capacity_ = 0;
+    first_ = 0;
+  }
+
+  void destroy_all_() {
+    for (size_type i = first_; i < capacity_; ++i)
+      if (is_full_(ctrl_[i])) allocator_.destroy(slots_ + i);
+  }
+
+  const key_type& key_of_(const value_type& value) const {
+    return KeyOfValue()(value);
+  }
+};
+
+}  // namespace ft
+
+#endif  // SWISSTABLE_H
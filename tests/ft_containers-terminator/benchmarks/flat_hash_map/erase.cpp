@@ -0,0 +1,47 @@
+// unordered_map/erase.cpp on ft::flat_hash_map
+#include "flat_hash_map_prelude.hpp"
+
+// std::advance for a table without an order: walks on from it and wraps
+// around at end()
+template <class Map>
+static void advance_wrapping(Map& m, typename Map::iterator& it, int n)
+{
+    for (; n > 0; --n) {
+        if (it == m.end() || ++it == m.end()) {
+            it = m.begin();
+        }
+    }
+}
+
+int main()
+{
+    SETUP;
+
+    FLAT_HASH_MAP<int, int> data;
+
+    for (std::size_t i = 0; i < MAXSIZE / 2; ++i) {
+        data.insert(NAMESPACE::make_pair(rand(), rand()));
+    }
+
+    FLAT_HASH_MAP<int, int> m(data);
+
+    timer t;
+    for (int i = 0; i < 300000; ++i) {
+        m.erase(m.begin());
+    }
+
+    FLAT_HASH_MAP<int, int>::iterator it = m.begin();
+    for (int i = 0; i < 1000000; ++i) {
+        advance_wrapping(m, it, i % 2 == 0 ? 2400 : 3064);
+        it = m.erase(it);
+    }
+
+    for (int i = 0; i < 100000; ++i) {
+        advance_wrapping(m, it, i % 2 == 0 ? 1 : 364);
+        int key = it->first;
+        advance_wrapping(m, it, 1);
+        m.erase(key);
+    }
+
+    PRINT_TIME(t);
+}
@@ -0,0 +1,24 @@
+// unordered_map/find.cpp: 10M random lookups, about 1 in 256 hits
+#include "flat_hash_map_prelude.hpp"
+
+int main()
+{
+    SETUP;
+
+    FLAT_HASH_MAP<int, int> data;
+
+    for (std::size_t i = 0; i < MAXSIZE / 2; ++i) {
+        data.insert(NAMESPACE::make_pair(rand(), rand()));
+    }
+
+    timer t;
+
+    for (int i = 0; i < 10000000; ++i) {
+        FLAT_HASH_MAP<int, int>::iterator it = data.find(rand());
+        if (it != data.end()) {
+            it->second = 64;
+        }
+    }
+
+    PRINT_TIME(t);
+}
@@ -0,0 +1,34 @@
+// 10M lookups of keys that are all present, in a table filled to just below
+// a load of 7/8 (the most either table allows before growing)
+#include "flat_hash_map_prelude.hpp"
+
+int main()
+{
+    SETUP;
+
+    FLAT_HASH_MAP<int, int> data;
+    data.max_load_factor(0.875f);
+    data.rehash(MAXSIZE / 2);
+    const std::size_t size =
+        static_cast<std::size_t>(data.bucket_count() * 0.87);
+
+    NAMESPACE::vector<int> keys;
+    while (data.size() < size) {
+        int key = rand();
+        if (data.insert(NAMESPACE::make_pair(key, key)).second) {
+            keys.push_back(key);
+        }
+    }
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        std::swap(keys[i], keys[static_cast<std::size_t>(rand()) % keys.size()]);
+    }
+
+    timer t;
+
+    for (int i = 0; i < 10000000; ++i) {
+        sum += data.find(keys[static_cast<std::size_t>(i) % keys.size()])->second & 1;
+    }
+
+    std::cout << "load " << data.load_factor() << ", " << sum << " odd: ";
+    PRINT_TIME(t);
+}
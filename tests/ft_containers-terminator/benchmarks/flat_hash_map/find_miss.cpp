@@ -0,0 +1,28 @@
+// find_hit.cpp with keys that are all absent: every lookup has to probe until
+// it sees an empty slot
+#include "flat_hash_map_prelude.hpp"
+
+int main()
+{
+    SETUP;
+
+    FLAT_HASH_MAP<int, int> data;
+    data.max_load_factor(0.875f);
+    data.rehash(MAXSIZE / 2);
+    const std::size_t size =
+        static_cast<std::size_t>(data.bucket_count() * 0.87);
+
+    while (data.size() < size) {
+        int key = rand();
+        data.insert(NAMESPACE::make_pair(key | 1, key));
+    }
+
+    timer t;
+
+    for (int i = 0; i < 10000000; ++i) {
+        sum += data.count(rand() & ~1);
+    }
+
+    std::cout << "load " << data.load_factor() << ", " << sum << " found: ";
+    PRINT_TIME(t);
+}
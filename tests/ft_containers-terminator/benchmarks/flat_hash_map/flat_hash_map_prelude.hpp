@@ -0,0 +1,11 @@
+#pragma once
+
+#include "flat_hash_map.hpp"
+#include "../unordered_map/unordered_map_prelude.hpp"
+
+// FLAT_HASH_MAP is ft::flat_hash_map, std::unordered_map for NAMESPACE=std
+#define ft_FLAT_HASH_MAP ft::flat_hash_map
+#define std_FLAT_HASH_MAP std::unordered_map
+#define FLAT_HASH_MAP_PASTE(ns) ns##_FLAT_HASH_MAP
+#define FLAT_HASH_MAP_EXPAND(ns) FLAT_HASH_MAP_PASTE(ns)
+#define FLAT_HASH_MAP FLAT_HASH_MAP_EXPAND(NAMESPACE)
@@ -0,0 +1,15 @@
+#include "flat_hash_map_prelude.hpp"
+
+int main()
+{
+    SETUP;
+
+    timer t;
+
+    FLAT_HASH_MAP<int, int> m;
+    for (std::size_t i = 0; i < MAXSIZE / 2; ++i) {
+        m[rand()] = rand();
+    }
+
+    PRINT_TIME(t);
+}
@@ -0,0 +1,16 @@
+#include "flat_hash_map_prelude.hpp"
+
+int main()
+{
+    SETUP;
+
+    FLAT_HASH_MAP<int, int> data;
+
+    timer t;
+
+    for (std::size_t i = 0; i < MAXSIZE / 2; ++i) {
+        data.insert(NAMESPACE::make_pair(rand(), rand()));
+    }
+
+    PRINT_TIME(t);
+}
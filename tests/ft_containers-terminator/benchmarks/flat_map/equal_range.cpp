@@ -0,0 +1,27 @@
+// map/equal_range.cpp on ft::flat_map, filled in one range insert
+#include "flat_map_prelude.hpp"
+
+int main()
+{
+    SETUP;
+
+    NAMESPACE::vector<NAMESPACE::pair<int, int> > pairs;
+
+    for (std::size_t i = 0; i < MAXSIZE / 2; ++i) {
+        pairs.push_back(NAMESPACE::make_pair(rand(), rand()));
+    }
+
+    FLAT_MAP<int, int> data(pairs.begin(), pairs.end());
+
+    timer t;
+
+    for (int i = 0; i < 10000000; ++i) {
+        NAMESPACE::pair<FLAT_MAP<int, int>::iterator, FLAT_MAP<int, int>::iterator> eq =
+            data.equal_range(rand());
+        if (eq.second != data.end()) {
+            eq.second->second = 64;
+        }
+    }
+
+    PRINT_TIME(t);
+}
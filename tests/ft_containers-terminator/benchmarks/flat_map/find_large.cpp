@@ -0,0 +1,37 @@
+// map/find_large.cpp on ft::flat_map, grown by range inserts
+#include "flat_map_prelude.hpp"
+
+int main()
+{
+    SETUP;
+
+    FLAT_MAP<int, int> data;
+    const std::size_t sizes[] = {1000000, 10000000, 100000000};
+
+    for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); ++s) {
+        std::size_t size = std::min(sizes[s], MAXSIZE);
+        while (data.size() < size) {
+            NAMESPACE::vector<NAMESPACE::pair<int, int> > pairs;
+            for (std::size_t i = data.size(); i < size; ++i) {
+                pairs.push_back(NAMESPACE::make_pair(rand(), rand()));
+            }
+            data.insert(pairs.begin(), pairs.end());
+        }
+
+        timer t;
+
+        for (int i = 0; i < 10000000; ++i) {
+            FLAT_MAP<int, int>::iterator it = data.find(rand());
+            if (it != data.end()) {
+                it->second = 64;
+            }
+        }
+
+        std::cout << data.size() << " keys: ";
+        PRINT_TIME(t);
+
+        if (size == MAXSIZE) {
+            break;
+        }
+    }
+}
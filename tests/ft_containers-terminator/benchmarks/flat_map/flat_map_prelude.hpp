@@ -0,0 +1,11 @@
+#pragma once
+
+#include "flat_map.hpp"
+#include "../map/map_prelude.hpp"
+
+// FLAT_MAP is ft::flat_map, std::map for NAMESPACE=std
+#define ft_FLAT_MAP ft::flat_map
+#define std_FLAT_MAP std::map
+#define FLAT_MAP_PASTE(ns) ns##_FLAT_MAP
+#define FLAT_MAP_EXPAND(ns) FLAT_MAP_PASTE(ns)
+#define FLAT_MAP FLAT_MAP_EXPAND(NAMESPACE)
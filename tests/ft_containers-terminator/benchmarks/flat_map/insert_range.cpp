@@ -0,0 +1,32 @@
+// map/insert_range.cpp on ft::flat_map
+#include "flat_map_prelude.hpp"
+
+int main()
+{
+    SETUP;
+
+    NAMESPACE::vector<NAMESPACE::pair<int, int> > data;
+
+    for (std::size_t i = 0; i < MAXSIZE / 4; ++i) {
+        data.push_back(NAMESPACE::make_pair(rand(), rand()));
+    }
+
+    FLAT_MAP<int, int> m;
+
+    timer t;
+
+    for (std::size_t i = 0; i < 2; ++i) {
+        m.insert(data.begin(), data.end());
+    }
+    sum += t.get_time();
+
+    FLAT_MAP<int, int> m2;
+    for (std::size_t i = 0; i < 5; ++i) {
+        t.reset();
+        m2.insert(m.begin(), m.end());
+        sum += t.get_time();
+        m2.clear();
+    }
+
+    PRINT_SUM();
+}
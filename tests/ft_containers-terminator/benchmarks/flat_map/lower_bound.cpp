@@ -0,0 +1,26 @@
+// map/lower_bound.cpp on ft::flat_map, filled in one range insert
+#include "flat_map_prelude.hpp"
+
+int main()
+{
+    SETUP;
+
+    NAMESPACE::vector<NAMESPACE::pair<int, int> > pairs;
+
+    for (std::size_t i = 0; i < MAXSIZE / 2; ++i) {
+        pairs.push_back(NAMESPACE::make_pair(rand(), rand()));
+    }
+
+    FLAT_MAP<int, int> data(pairs.begin(), pairs.end());
+
+    timer t;
+
+    for (int i = 0; i < 10000000; ++i) {
+        FLAT_MAP<int, int>::iterator it = data.lower_bound(rand());
+        if (it != data.end()) {
+            it->second = 64;
+        }
+    }
+
+    PRINT_TIME(t);
+}
@@ -0,0 +1,26 @@
+// map/find.cpp on a frozen snapshot of the map
+#include "frozen_map_prelude.hpp"
+
+int main()
+{
+    SETUP;
+
+    NAMESPACE::map<int, int> data;
+
+    for (std::size_t i = 0; i < MAXSIZE / 2; ++i) {
+        data.insert(NAMESPACE::make_pair(rand(), rand()));
+    }
+
+    const FROZEN_MAP<int, int> frozen(data.begin(), data.end());
+
+    timer t;
+
+    for (int i = 0; i < 10000000; ++i) {
+        FROZEN_MAP<int, int>::const_iterator it = frozen.find(rand());
+        if (it != frozen.end()) {
+            sum += it->second;
+        }
+    }
+
+    PRINT_TIME(t);
+}
@@ -0,0 +1,35 @@
+// map/find_large.cpp on a frozen snapshot of the map
+#include "frozen_map_prelude.hpp"
+
+int main()
+{
+    SETUP;
+
+    NAMESPACE::map<int, int> data;
+    const std::size_t sizes[] = {1000000, 10000000, 100000000};
+
+    for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); ++s) {
+        std::size_t size = std::min(sizes[s], MAXSIZE);
+        while (data.size() < size) {
+            data.insert(NAMESPACE::make_pair(rand(), rand()));
+        }
+
+        const FROZEN_MAP<int, int> frozen(data.begin(), data.end());
+
+        timer t;
+
+        for (int i = 0; i < 10000000; ++i) {
+            FROZEN_MAP<int, int>::const_iterator it = frozen.find(rand());
+            if (it != frozen.end()) {
+                sum += it->second;
+            }
+        }
+
+        std::cout << data.size() << " keys: ";
+        PRINT_TIME(t);
+
+        if (size == MAXSIZE) {
+            break;
+        }
+    }
+}
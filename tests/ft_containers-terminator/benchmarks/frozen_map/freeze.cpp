@@ -0,0 +1,22 @@
+// Building a snapshot of a map with MAXSIZE / 2 elements, 5 times
+#include "frozen_map_prelude.hpp"
+
+int main()
+{
+    SETUP;
+
+    NAMESPACE::map<int, int> data;
+
+    for (std::size_t i = 0; i < MAXSIZE / 2; ++i) {
+        data.insert(NAMESPACE::make_pair(rand(), rand()));
+    }
+
+    timer t;
+
+    for (int i = 0; i < 5; ++i) {
+        const FROZEN_MAP<int, int> frozen(data.begin(), data.end());
+        sum += frozen.size() & 1;
+    }
+
+    PRINT_TIME(t);
+}
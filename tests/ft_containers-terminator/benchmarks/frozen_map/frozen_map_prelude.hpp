@@ -0,0 +1,12 @@
+#pragma once
+
+#include "../map/map_prelude.hpp"
+#include "frozen_map.hpp"
+
+// FROZEN_MAP is ft::frozen_map, std::map for NAMESPACE=std. Both are built
+// from the sorted range of a map, which is what ft::map::freeze() does
+#define ft_FROZEN_MAP ft::frozen_map
+#define std_FROZEN_MAP std::map
+#define FROZEN_MAP_PASTE(ns) ns##_FROZEN_MAP
+#define FROZEN_MAP_EXPAND(ns) FROZEN_MAP_PASTE(ns)
+#define FROZEN_MAP FROZEN_MAP_EXPAND(NAMESPACE)
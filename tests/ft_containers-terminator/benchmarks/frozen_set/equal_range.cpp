@@ -0,0 +1,27 @@
+// set/equal_range.cpp on a frozen snapshot of the set
+#include "frozen_set_prelude.hpp"
+
+int main()
+{
+    SETUP;
+
+    NAMESPACE::set<int> data;
+
+    for (std::size_t i = 0; i < MAXSIZE / 2; ++i) {
+        data.insert(rand());
+    }
+
+    const FROZEN_SET<int> frozen(data.begin(), data.end());
+
+    timer t;
+
+    for (int i = 0; i < 10000000; ++i) {
+        NAMESPACE::pair<FROZEN_SET<int>::const_iterator, FROZEN_SET<int>::const_iterator> eq =
+            frozen.equal_range(rand());
+        if (eq.first != eq.second) {
+            x = *eq.first;
+        }
+    }
+
+    PRINT_TIME(t);
+}
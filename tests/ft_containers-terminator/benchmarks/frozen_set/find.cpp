@@ -0,0 +1,26 @@
+// set/find.cpp on a frozen snapshot of the set
+#include "frozen_set_prelude.hpp"
+
+int main()
+{
+    SETUP;
+
+    NAMESPACE::set<int> data;
+
+    for (std::size_t i = 0; i < MAXSIZE / 2; ++i) {
+        data.insert(rand());
+    }
+
+    const FROZEN_SET<int> frozen(data.begin(), data.end());
+
+    timer t;
+
+    for (int i = 0; i < 10000000; ++i) {
+        FROZEN_SET<int>::const_iterator it = frozen.find(rand());
+        if (it != frozen.end()) {
+            x = *it;
+        }
+    }
+
+    PRINT_TIME(t);
+}
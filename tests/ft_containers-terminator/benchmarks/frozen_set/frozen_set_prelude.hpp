@@ -0,0 +1,12 @@
+#pragma once
+
+#include "../set/set_prelude.hpp"
+#include "frozen_set.hpp"
+
+// FROZEN_SET is ft::frozen_set, std::set for NAMESPACE=std. Both are built
+// from the sorted range of a set, which is what ft::set::freeze() does
+#define ft_FROZEN_SET ft::frozen_set
+#define std_FROZEN_SET std::set
+#define FROZEN_SET_PASTE(ns) ns##_FROZEN_SET
+#define FROZEN_SET_EXPAND(ns) FROZEN_SET_PASTE(ns)
+#define FROZEN_SET FROZEN_SET_EXPAND(NAMESPACE)
@@ -0,0 +1,33 @@
+// dtor.cpp with nodes from ft::pool_allocator: destroying the map hands back
+// whole blocks instead of every node on its own. Build with -DNO_POOL to
+// compare against std::allocator.
+#include "pool_allocator.hpp"
+#include "map_prelude.hpp"
+
+#ifdef NO_POOL
+typedef std::allocator<NAMESPACE::pair<const int, int> > allocator;
+#else
+typedef ft::pool_allocator<NAMESPACE::pair<const int, int> > allocator;
+#endif
+
+int main()
+{
+    SETUP;
+
+    NAMESPACE::vector<NAMESPACE::pair<int, int> > data;
+
+    for (std::size_t i = 0; i < MAXSIZE; ++i) {
+        data.push_back(NAMESPACE::make_pair(rand(), rand()));
+    }
+
+    timer t;
+
+    for (int i = 0; i < 5; ++i) {
+        sum += t.get_time();
+        NAMESPACE::map<int, int, std::less<int>, allocator> m(data.begin(),
+                                                              data.begin() + 2500000);
+        t.reset();
+    }
+
+    PRINT_SUM();
+}
@@ -0,0 +1,39 @@
+// Random lookups into maps of 1M, 10M and 100M keys (capped by MAXSIZE), where
+// every descent misses the cache. ft::map is built with prefetching during
+// the descent; build with -DNO_PREFETCH to compare against plain descents.
+#ifndef NO_PREFETCH
+#define FT_RBTREE_PREFETCH
+#endif
+
+#include "map_prelude.hpp"
+
+int main()
+{
+    SETUP;
+
+    NAMESPACE::map<int, int> data;
+    const std::size_t sizes[] = {1000000, 10000000, 100000000};
+
+    for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); ++s) {
+        std::size_t size = std::min(sizes[s], MAXSIZE);
+        while (data.size() < size) {
+            data.insert(NAMESPACE::make_pair(rand(), rand()));
+        }
+
+        timer t;
+
+        for (int i = 0; i < 10000000; ++i) {
+            NAMESPACE::map<int, int>::iterator it = data.find(rand());
+            if (it != data.end()) {
+                it->second = 64;
+            }
+        }
+
+        std::cout << data.size() << " keys: ";
+        PRINT_TIME(t);
+
+        if (size == MAXSIZE) {
+            break;
+        }
+    }
+}
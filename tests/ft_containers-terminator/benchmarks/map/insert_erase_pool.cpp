@@ -0,0 +1,27 @@
+// A map that keeps going from one element back to empty. The pool has to
+// keep its block around, or every cycle allocates and frees a whole block.
+// Build with -DNO_POOL to compare against std::allocator.
+#include "pool_allocator.hpp"
+#include "map_prelude.hpp"
+
+#ifdef NO_POOL
+typedef std::allocator<NAMESPACE::pair<const int, int> > allocator;
+#else
+typedef ft::pool_allocator<NAMESPACE::pair<const int, int> > allocator;
+#endif
+
+int main()
+{
+    SETUP;
+
+    NAMESPACE::map<int, int, std::less<int>, allocator> data;
+
+    timer t;
+
+    for (int i = 0; i < 5000000; ++i) {
+        data[i] = i;
+        data.erase(i);
+    }
+
+    PRINT_TIME(t);
+}
@@ -0,0 +1,26 @@
+// insert.cpp with nodes from ft::pool_allocator, which carves them out of
+// large blocks instead of calling operator new for each one. Build with
+// -DNO_POOL to compare against std::allocator.
+#include "pool_allocator.hpp"
+#include "map_prelude.hpp"
+
+#ifdef NO_POOL
+typedef std::allocator<NAMESPACE::pair<const int, int> > allocator;
+#else
+typedef ft::pool_allocator<NAMESPACE::pair<const int, int> > allocator;
+#endif
+
+int main()
+{
+    SETUP;
+
+    NAMESPACE::map<int, int, std::less<int>, allocator> data;
+
+    timer t;
+
+    for (std::size_t i = 0; i < MAXSIZE / 2; ++i) {
+        data.insert(NAMESPACE::make_pair(rand(), rand()));
+    }
+
+    PRINT_TIME(t);
+}
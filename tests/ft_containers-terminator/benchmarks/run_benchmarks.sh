@@ -69,7 +69,7 @@ benchmark_files() {
 }
 
 run_container_benchmarks() {
-    CONTAINERS="vector map set"
+    CONTAINERS="vector map set unordered_map flat_hash_map flat_map frozen_map frozen_set"
 
     if [ $# -ne 0 ]; then
         CONTAINERS=$@;
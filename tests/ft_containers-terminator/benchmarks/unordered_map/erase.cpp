@@ -0,0 +1,49 @@
+// map/erase.cpp on a table without an order: the erase positions are counted
+// on from the previous erase instead of from begin() or end(), and the last
+// loop erases by key
+#include "unordered_map_prelude.hpp"
+
+// std::advance for a table without an order: walks on from it and wraps
+// around at end()
+template <class Map>
+static void advance_wrapping(Map& m, typename Map::iterator& it, int n)
+{
+    for (; n > 0; --n) {
+        if (it == m.end() || ++it == m.end()) {
+            it = m.begin();
+        }
+    }
+}
+
+int main()
+{
+    SETUP;
+
+    NAMESPACE::unordered_map<int, int> data;
+
+    for (std::size_t i = 0; i < MAXSIZE / 2; ++i) {
+        data.insert(NAMESPACE::make_pair(rand(), rand()));
+    }
+
+    NAMESPACE::unordered_map<int, int> m(data);
+
+    timer t;
+    for (int i = 0; i < 300000; ++i) {
+        m.erase(m.begin());
+    }
+
+    NAMESPACE::unordered_map<int, int>::iterator it = m.begin();
+    for (int i = 0; i < 1000000; ++i) {
+        advance_wrapping(m, it, i % 2 == 0 ? 2400 : 3064);
+        it = m.erase(it);
+    }
+
+    for (int i = 0; i < 100000; ++i) {
+        advance_wrapping(m, it, i % 2 == 0 ? 1 : 364);
+        int key = it->first;
+        advance_wrapping(m, it, 1);
+        m.erase(key);
+    }
+
+    PRINT_TIME(t);
+}
@@ -0,0 +1,32 @@
+#include "unordered_map_prelude.hpp"
+#include <iterator>
+
+int main()
+{
+    SETUP;
+
+    NAMESPACE::unordered_map<int, int> data;
+
+    for (std::size_t i = 0; i < MAXSIZE / 2; ++i) {
+        data.insert(NAMESPACE::make_pair(rand(), rand()));
+    }
+
+    timer t;
+
+    for (int i = 0; i < 10; ++i) {
+        NAMESPACE::unordered_map<int, int> m(data);
+
+        t.reset();
+        for (int i = 0; i < 100; ++i) {
+            NAMESPACE::unordered_map<int, int>::iterator it = m.begin();
+            std::advance(it, i % 2 == 0 ? 2400 : 3064);
+            m.erase(m.begin(), it);
+        }
+
+        m.erase(m.begin(), m.end());
+
+        sum += t.get_time();
+    }
+
+    PRINT_SUM();
+}
@@ -0,0 +1,34 @@
+// Random lookups into maps of 1M, 10M and 100M keys (capped by MAXSIZE), the
+// same sizes as map/find_large.cpp
+#include "unordered_map_prelude.hpp"
+
+int main()
+{
+    SETUP;
+
+    NAMESPACE::unordered_map<int, int> data;
+    const std::size_t sizes[] = {1000000, 10000000, 100000000};
+
+    for (std::size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); ++s) {
+        std::size_t size = std::min(sizes[s], MAXSIZE);
+        while (data.size() < size) {
+            data.insert(NAMESPACE::make_pair(rand(), rand()));
+        }
+
+        timer t;
+
+        for (int i = 0; i < 10000000; ++i) {
+            NAMESPACE::unordered_map<int, int>::iterator it = data.find(rand());
+            if (it != data.end()) {
+                it->second = 64;
+            }
+        }
+
+        std::cout << data.size() << " keys: ";
+        PRINT_TIME(t);
+
+        if (size == MAXSIZE) {
+            break;
+        }
+    }
+}
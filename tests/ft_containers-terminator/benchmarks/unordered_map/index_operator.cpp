@@ -0,0 +1,15 @@
+#include "unordered_map_prelude.hpp"
+
+int main()
+{
+    SETUP;
+
+    timer t;
+
+    NAMESPACE::unordered_map<int, int> m;
+    for (std::size_t i = 0; i < MAXSIZE / 2; ++i) {
+        m[rand()] = rand();
+    }
+
+    PRINT_TIME(t);
+}
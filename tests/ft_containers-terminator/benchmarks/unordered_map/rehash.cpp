@@ -0,0 +1,18 @@
+// index_operator.cpp with the table sized up front, so it never rehashes
+// while filling. reserve(n) is C++11, this is what it does
+#include "unordered_map_prelude.hpp"
+
+int main()
+{
+    SETUP;
+
+    timer t;
+
+    NAMESPACE::unordered_map<int, int> m;
+    m.rehash(static_cast<std::size_t>(MAXSIZE / 2 / m.max_load_factor()) + 1);
+    for (std::size_t i = 0; i < MAXSIZE / 2; ++i) {
+        m[rand()] = rand();
+    }
+
+    PRINT_TIME(t);
+}
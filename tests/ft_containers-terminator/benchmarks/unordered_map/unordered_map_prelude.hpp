@@ -0,0 +1,21 @@
+#pragma once
+
+#include "unordered_map.hpp"
+#include "vector.hpp"
+#include <vector>
+
+// C++98 only has the hash containers of TR1
+#if __cplusplus >= 201103L
+#include <unordered_map>
+#else
+#include <tr1/unordered_map>
+namespace std {
+using tr1::unordered_map;
+}
+#endif
+
+#include "prelude.hpp"
+
+// Same budget as map: a std::unordered_map<int, int> node is a pair and a
+// pointer plus its bucket, ft::unordered_map needs 2-4 slots of 9 bytes
+#define MAXSIZE ((std::size_t)MAXRAM / 128)
@@ -0,0 +1,43 @@
+// push_back 3/4 of MAXSIZE ints into a vector whose large buffers come from
+// ft::mmap_allocator. ft::vector grows them with mremap, so nothing is copied
+// and the old buffer never lives next to the new one: compare the time and
+// the peak RSS with -DNO_MMAP, which uses a plain std::allocator vector.
+// -DHUGE_PAGES advises transparent huge pages. Not all of MAXSIZE, so
+// the last buffer isn't completely filled, and the values aren't random so
+// the time is spent growing the vector.
+#include "mmap_allocator.hpp"
+#include "vector_prelude.hpp"
+
+#include <sys/resource.h>
+
+#ifdef NO_MMAP
+typedef std::allocator<int> allocator;
+#elif defined(HUGE_PAGES)
+typedef ft::mmap_allocator<int, 1024 * 1024, true> allocator;
+#else
+typedef ft::mmap_allocator<int> allocator;
+#endif
+
+int main()
+{
+    SETUP;
+
+    const std::size_t size = MAXSIZE / 4 * 3;
+
+    timer t;
+    for (int i = 0; i < 3; ++i) {
+        NAMESPACE::vector<int, allocator> v;
+
+        for (std::size_t i = 0; i < size; ++i) {
+            v.push_back(i);
+        }
+
+        BLOCK_OPTIMIZATION(v);
+    }
+
+    PRINT_TIME(t);
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    std::cout << "peak RSS: " << usage.ru_maxrss / 1024 << "MB" << std::endl;
+}
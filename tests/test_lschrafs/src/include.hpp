@@ -3,21 +3,76 @@
 #if TESTSTD  // if set, use standard template library
 
 #define NAMESPACE std
+#include <deque>
 #include <map>
 #include <set>
 #include <stack>
 #include <vector>
+#if __cplusplus >= 201103L
+#include <unordered_map>
+#include <unordered_set>
+#else
+// C++98 only has the hash containers of TR1
+#include <tr1/unordered_map>
+#include <tr1/unordered_set>
+namespace std {
+using tr1::unordered_map;
+using tr1::unordered_set;
+namespace tr1 {
+// Only C++11 compares hash containers
+template <class K, class T, class H, class E, class A>
+bool operator==(const unordered_map<K, T, H, E, A> &lhs,
+                const unordered_map<K, T, H, E, A> &rhs) {
+  if (lhs.size() != rhs.size()) return false;
+  typename unordered_map<K, T, H, E, A>::const_iterator it = lhs.begin();
+  for (; it != lhs.end(); ++it) {
+    typename unordered_map<K, T, H, E, A>::const_iterator other =
+        rhs.find(it->first);
+    if (other == rhs.end() || !(other->second == it->second)) return false;
+  }
+  return true;
+}
+template <class K, class T, class H, class E, class A>
+bool operator!=(const unordered_map<K, T, H, E, A> &lhs,
+                const unordered_map<K, T, H, E, A> &rhs) {
+  return !(lhs == rhs);
+}
+template <class K, class H, class E, class A>
+bool operator==(const unordered_set<K, H, E, A> &lhs,
+                const unordered_set<K, H, E, A> &rhs) {
+  if (lhs.size() != rhs.size()) return false;
+  typename unordered_set<K, H, E, A>::const_iterator it = lhs.begin();
+  for (; it != lhs.end(); ++it)
+    if (rhs.find(*it) == rhs.end()) return false;
+  return true;
+}
+}  // namespace tr1
+}  // namespace std
+#endif
 
 #else
 
 #define NAMESPACE ft
+#include "../../../chunked_storage.hpp"
+#include "../../../deque.hpp"
+#include "../../../flat_hash_map.hpp"
+#include "../../../flat_hash_set.hpp"
+#include "../../../flat_map.hpp"
+#include "../../../flat_set.hpp"
+#include "../../../frozen_map.hpp"
+#include "../../../frozen_set.hpp"
 #include "../../../map.hpp"
 #include "../../../set.hpp"
+#include "../../../small_vector.hpp"
 #include "../../../stack.hpp"
+#include "../../../unordered_map.hpp"
+#include "../../../unordered_set.hpp"
 #include "../../../vector.hpp"
 
 #endif
 
+#include "../../../mmap_allocator.hpp"
+#include "../../../pool_allocator.hpp"
 #include <iostream>
 #include <stdlib.h>
 
@@ -34,4 +89,7 @@
 void test_vector();
 void test_map();
 void test_stack();
-void test_set();
\ No newline at end of file
+void test_set();
+void test_deque();
+void test_unordered_map();
+void test_unordered_set();
\ No newline at end of file
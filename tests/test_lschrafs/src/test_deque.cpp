@@ -0,0 +1,131 @@
+#include "include.hpp"
+
+#include <string>
+
+template <class T>
+static void print_deque(const NAMESPACE::deque<T> &deq) {
+  size_t hash = 0;
+  size_t size = deq.size();
+  for (size_t i = 0; i < size; ++i) {
+    hash += (int16_t)deq[i];
+    hash *= 13;
+    hash %= 65536;
+  }
+  std::cout << "Size: " << deq.size() << ", Hash: " << hash << std::endl;
+}
+
+void test_deque() {
+  std::cout << CYAN << "DEQUE TESTS:" << std::endl;
+
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  NAMESPACE::deque<int> deq1;
+  for (int i = 0; i < 10000; ++i) {
+    if (rand() % 2)
+      deq1.push_back(rand());
+    else
+      deq1.push_front(rand());
+  }
+  NAMESPACE::deque<int> deq2(deq1);
+  NAMESPACE::deque<int> deq3(deq1.begin() + 100, deq1.end() - 100);
+  NAMESPACE::deque<int> deq4(5000, 42);
+  deq4 = deq3;
+  print_deque(deq1);
+  print_deque(deq2);
+  print_deque(deq3);
+  print_deque(deq4);
+
+  //**************************************************
+  // Iterators
+  //**************************************************
+
+  NAMESPACE::deque<int>::iterator it = deq1.begin() + 4500;
+  NAMESPACE::deque<int>::const_iterator cit = it;
+  std::cout << *it << " " << *(it - 3000) << " " << it[2000] << std::endl;
+  std::cout << (cit - deq1.begin()) << " " << (deq1.end() - it) << std::endl;
+  std::cout << (it < deq1.end()) << " " << (cit >= deq1.begin() + 4500)
+            << std::endl;
+  std::cout << *deq1.rbegin() << " " << *(deq1.rend() - 1) << std::endl;
+
+  //**************************************************
+  // Capacity + Modifiers
+  //**************************************************
+
+  for (int i = 0; i < 200; ++i) {
+    size_t position = rand() % (deq1.size() + 1);
+    switch (rand() % 6) {
+      case 0:
+        deq1.insert(deq1.begin() + position, rand());
+        break;
+      case 1:
+        deq1.insert(deq1.begin() + position, rand() % 1000 + 1, rand());
+        break;
+      case 2:
+        deq1.insert(deq1.begin() + position, deq4.begin(),
+                    deq4.begin() + rand() % 1000);
+        break;
+      case 3:
+        if (position < deq1.size())
+          deq1.erase(deq1.begin() + position,
+                     deq1.begin() + position +
+                         rand() % (deq1.size() - position + 1));
+        break;
+      case 4:
+        deq1.resize(rand() % 20000, rand());
+        break;
+      default:
+        deq1.pop_front();
+        deq1.pop_back();
+    }
+  }
+  print_deque(deq1);
+  deq1.swap(deq2);
+  print_deque(deq1);
+  print_deque(deq2);
+  std::cout << (deq1 == deq2) << " " << (deq1 < deq2) << " " << (deq2 >= deq3)
+            << std::endl;
+  deq2.clear();
+  deq2.assign(300, 7);
+  print_deque(deq2);
+
+  NAMESPACE::deque<std::string> deq5;
+  for (int i = 0; i < 1000; ++i) {
+    std::string value(rand() % 5 + 1, 'a' + i % 26);
+    if (i % 3)
+      deq5.push_front(value);
+    else
+      deq5.insert(deq5.begin() + rand() % (deq5.size() + 1), value);
+    if (i % 7 == 0) deq5.erase(deq5.begin() + rand() % deq5.size());
+  }
+  NAMESPACE::deque<int> deq6;
+  for (size_t i = 0; i < deq5.size(); ++i) deq6.push_back(deq5[i][0]);
+  print_deque(deq6);
+
+  // As the container of a stack
+  NAMESPACE::stack<int, NAMESPACE::deque<int> > stack1;
+  for (int i = 0; i < 100000; ++i) stack1.push(i);
+  while (stack1.size() > 10) stack1.pop();
+  std::cout << stack1.top() << std::endl;
+
+  //**************************************************
+  // Performance
+  //**************************************************
+
+  NAMESPACE::deque<int> deq7;
+  for (int i = 0; i < 10000000; ++i) {
+    deq7.push_back(i);
+    deq7.push_front(i);
+  }
+  print_deque(deq7);
+  while (!deq7.empty()) {
+    deq7.pop_back();
+    if (!deq7.empty()) deq7.pop_front();
+  }
+}
+
+int main(void) {
+  srand(2);  // Set the seed
+  test_deque();
+}
@@ -1,12 +1,16 @@
 #include "include.hpp"
 
-template <class T, class U>
-static void print_map(NAMESPACE::map<T, U> &map) {
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+template <class Map>
+static void print_map(Map &map) {
   if (map.empty())
     return;
   size_t hash = 0;
-  typename NAMESPACE::map<T, U>::iterator start = map.begin();
-  typename NAMESPACE::map<T, U>::iterator end = map.end();
+  typename Map::iterator start = map.begin();
+  typename Map::iterator end = map.end();
 
   while (start != end) {
     hash += (int16_t)((*start).second);
@@ -18,6 +22,19 @@ static void print_map(NAMESPACE::map<T, U> &map) {
   std::cout << "Size: " << map.size() << ", Hash: " << hash << std::endl;
 }
 
+// Counts how often a mapped_type is built, lookups must not build any
+struct counted {
+  static int constructions;
+  counted() { ++constructions; }
+  counted(const counted &) { ++constructions; }
+};
+int counted::constructions = 0;
+
+// 12 bytes: pool slots for it are not a multiple of the pointer size
+struct rgb {
+  int r, g, b;
+};
+
 void test_map() {
   std::cout << YELLOW << "MAP TESTS:" << std::endl;
 
@@ -57,6 +74,23 @@ void test_map() {
   map3[random_number] = random_number + 1;
   std::cout << map3[random_number] << std::endl;
 
+  // try_emplace() and insert_or_assign() are C++17, std::map has to emulate
+  // them with insert() and operator[]
+  std::cout << "map::try_emplace() + map::insert_or_assign()" << std::endl;
+  for (int i = 0; i < 1000; ++i) {
+    int key = rand() % 2000;
+#if TESTSTD
+    bool inserted = map3.insert(std::make_pair(key, i)).second;
+    if (i % 3 == 0) map3[key + 1] = i;
+#else
+    bool inserted = map3.try_emplace(key, i).second;
+    if (i % 3 == 0) map3.insert_or_assign(key + 1, i);
+#endif
+    std::cout << inserted;
+  }
+  std::cout << std::endl;
+  print_map(map3);
+
   std::cout << "map::at()" << std::endl;
   std::cout << map3.at(random_number) << std::endl;
 
@@ -106,6 +140,25 @@ void test_map() {
   map4.erase(map4.begin(), map4.end());
   print_map(map4);
 
+  std::cout << "map::erase() keeps other iterators valid" << std::endl;
+  for (int i = 0; i < 1000; ++i) map4[i] = i;
+  for (int i = 0; i < 100; ++i) {
+    NAMESPACE::map<int, int>::iterator pos = map4.find(rand() % 1000);
+    if (pos == map4.end() || pos == map4.begin()) continue;
+    NAMESPACE::map<int, int>::iterator before = pos;
+    NAMESPACE::map<int, int>::iterator after = pos;
+    --before;
+    ++after;
+    map4.erase(pos);
+    std::cout << before->first << " " << (after == map4.end() ? -1 : after->first)
+              << " ";
+  }
+  std::cout << std::endl;
+  print_map(map4);
+  NAMESPACE::map<int, int>::iterator from = map4.lower_bound(200);
+  map4.erase(from, map4.lower_bound(700));
+  print_map(map4);
+
   //**************************************************
   // Performance
   //**************************************************
@@ -119,6 +172,289 @@ void test_map() {
   print_map(map5);
   
   map5.erase(map5.begin(), map5.end());
+
+  std::cout << "map::insert() with hint" << std::endl;
+  NAMESPACE::map<int, int> map9;
+  for (int i = 0; i < 10000; ++i)
+    map9.insert(map9.end(), NAMESPACE::make_pair(i * 3, i));
+  for (int i = 0; i < 10000; ++i) {
+    int tmp = rand() % 30000;
+    map9.insert(map9.lower_bound(tmp), NAMESPACE::make_pair(tmp, tmp));
+    map9.insert(map9.begin(), NAMESPACE::make_pair(tmp + 1, tmp));
+  }
+  print_map(map9);
+
+  //**************************************************
+  // Lookup
+  //**************************************************
+
+  std::cout << "Lookup without constructing mapped_type" << std::endl;
+  NAMESPACE::map<int, counted> map8;
+  for (int i = 0; i < 100; ++i) map8[i * 2];
+  counted::constructions = 0;
+  size_t found = 0;
+  for (int i = 0; i < 200; ++i) {
+    found += map8.count(i);
+    found += map8.find(i) != map8.end();
+    found += map8.lower_bound(i) != map8.upper_bound(i);
+  }
+  found += map8.erase(3) + map8.erase(4);
+  std::cout << found << " " << counted::constructions << std::endl;
+
+  std::cout << "map::find_batch() + map::lower_bound_batch()" << std::endl;
+  typedef NAMESPACE::map<int, int>::iterator iterator;
+  typedef NAMESPACE::map<int, int>::const_iterator const_iterator;
+  const NAMESPACE::map<int, int> &cmap9 = map9;
+  std::vector<int> keys;
+  for (int i = 0; i < 1000; ++i) keys.push_back(rand() % 32000);
+  // unsorted keys, ascending keys, then descending keys for the sorted
+  // variant, which has to fall back to searching from the root
+  for (int pass = 0; pass < 3; ++pass) {
+    if (pass == 1) std::sort(keys.begin(), keys.end());
+    if (pass == 2) std::reverse(keys.begin(), keys.end());
+    std::vector<iterator> finds;
+    std::vector<const_iterator> bounds;
+#if TESTSTD
+    for (size_t i = 0; i < keys.size(); ++i) {
+      finds.push_back(map9.find(keys[i]));
+      bounds.push_back(cmap9.lower_bound(keys[i]));
+    }
+#else
+    if (pass == 0) {
+      map9.find_batch(keys.begin(), keys.end(), std::back_inserter(finds));
+      cmap9.lower_bound_batch(keys.begin(), keys.end(),
+                              std::back_inserter(bounds));
+    } else {
+      map9.find_batch_sorted(keys.begin(), keys.end(),
+                             std::back_inserter(finds));
+      cmap9.lower_bound_batch_sorted(keys.begin(), keys.end(),
+                                     std::back_inserter(bounds));
+    }
+#endif
+    size_t hash = 0;
+    for (size_t i = 0; i < keys.size(); ++i) {
+      hash += finds[i] == map9.end() ? 1 : finds[i]->first;
+      hash += bounds[i] == cmap9.end() ? 1 : bounds[i]->first;
+      hash *= 13;
+      hash %= 65536;
+    }
+    std::cout << finds.size() << " " << bounds.size() << " " << hash
+              << std::endl;
+  }
+
+  // Keys that are converted to key_type, still in descending order
+  NAMESPACE::map<long, int> long_map(map9.begin(), map9.end());
+  std::vector<NAMESPACE::map<long, int>::iterator> long_finds;
+  std::vector<NAMESPACE::map<long, int>::iterator> long_batch_finds;
+  std::vector<NAMESPACE::map<long, int>::iterator> long_bounds;
+#if TESTSTD
+  for (size_t i = 0; i < keys.size(); ++i) {
+    long_finds.push_back(long_map.find(keys[i]));
+    long_batch_finds.push_back(long_map.find(keys[i]));
+    long_bounds.push_back(long_map.lower_bound(keys[i]));
+  }
+#else
+  long_map.find_batch_sorted(keys.begin(), keys.end(),
+                             std::back_inserter(long_finds));
+  long_map.find_batch(keys.begin(), keys.end(),
+                      std::back_inserter(long_batch_finds));
+  long_map.lower_bound_batch(keys.begin(), keys.end(),
+                             std::back_inserter(long_bounds));
+#endif
+  found = 0;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    found += long_finds[i] == long_map.find(keys[i]);
+    found += long_batch_finds[i] == long_map.find(keys[i]);
+    found += long_bounds[i] == long_map.lower_bound(keys[i]);
+  }
+  std::cout << found << std::endl;
+
+  //**************************************************
+  // Pool allocator
+  //**************************************************
+
+  std::cout << "map with ft::pool_allocator" << std::endl;
+  typedef ft::pool_allocator<NAMESPACE::pair<const int, int> > pool_type;
+  NAMESPACE::map<int, int, std::less<int>, pool_type> map6;
+  for (int i = 0; i < 100000; ++i) {
+    int tmp = rand();
+    map6.insert(NAMESPACE::make_pair(tmp, tmp));
+  }
+  print_map(map6);
+  for (int i = 0; i < 50000; ++i) map6.erase(rand());
+  print_map(map6);
+  NAMESPACE::map<int, int, std::less<int>, pool_type> map7(map6);
+  map6.clear();
+  for (int i = 0; i < 1000; ++i) map6[rand()] = i;
+  print_map(map6);
+  print_map(map7);
+  // Slots of objects whose size isn't a multiple of the pointer size stay
+  // aligned for the free list that is threaded through them
+  ft::pool_allocator<rgb> rgb_pool;
+  std::vector<rgb *> colors;
+  for (int i = 0; i < 100; ++i) {
+    rgb color = {i, i * 2, i * 3};
+    colors.push_back(rgb_pool.allocate(1));
+    rgb_pool.construct(colors.back(), color);
+  }
+  for (int i = 0; i < 100; i += 2) rgb_pool.deallocate(colors[i], 1);
+  for (int i = 0; i < 100; i += 2) colors[i] = rgb_pool.allocate(1);
+  int misaligned = 0;
+  int sum = 0;
+  for (int i = 0; i < 100; ++i) {
+    misaligned += reinterpret_cast<std::size_t>(colors[i]) % sizeof(void *);
+    if (i % 2) sum += colors[i]->r + colors[i]->g + colors[i]->b;
+  }
+  for (int i = 0; i < 100; ++i) rgb_pool.deallocate(colors[i], 1);
+  std::cout << misaligned << " " << sum << std::endl;
+
+  //**************************************************
+  // map::freeze()
+  //**************************************************
+
+  // Read-only snapshot, checked against a const std::map
+  std::cout << "map::freeze()" << std::endl;
+#if TESTSTD
+  typedef const std::map<int, int> frozen_map;
+  frozen_map frozen(map9);
+#else
+  typedef const ft::frozen_map<int, int> frozen_map;
+  frozen_map frozen = map9.freeze();
+#endif
+  std::cout << frozen.size() << " " << frozen.empty() << std::endl;
+  found = 0;
+  for (int i = -1; i < 33000; ++i) {
+    found += frozen.count(i);
+    frozen_map::const_iterator lower = frozen.lower_bound(i);
+    frozen_map::const_iterator upper = frozen.upper_bound(i);
+    found += lower == frozen.end() ? 1 : lower->first;
+    found += upper == frozen.end() ? 1 : upper->second;
+    if (frozen.find(i) != frozen.end()) found += frozen.at(i);
+    found %= 65536;
+  }
+  std::cout << found << std::endl;
+  size_t frozen_hash = 0;
+  for (frozen_map::const_reverse_iterator it3 = frozen.rbegin();
+       it3 != frozen.rend(); ++it3)
+    frozen_hash = (frozen_hash + it3->first) * 13 % 65536;
+  std::cout << frozen_hash << std::endl;
+  std::cout << std::equal(frozen.begin(), frozen.end(), map9.begin())
+            << std::endl;
+
+  //**************************************************
+  // ft::flat_map
+  //**************************************************
+
+  // Same interface on a sorted vector, checked against std::map
+  std::cout << "flat_map" << std::endl;
+#if TESTSTD
+  typedef std::map<int, int> flat_map;
+#else
+  typedef ft::flat_map<int, int> flat_map;
+#endif
+  std::vector<NAMESPACE::pair<int, int> > pairs;
+  for (int i = 0; i < 10000; ++i)
+    pairs.push_back(NAMESPACE::make_pair(rand() % 20000, i));
+  // Duplicate keys: the first one is kept
+  flat_map map10(pairs.begin(), pairs.end());
+  print_map(map10);
+  map10.insert(pairs.begin(), pairs.begin() + 5000);
+  print_map(map10);
+  for (int i = 0; i < 20000; ++i) {
+    int key = rand() % 20000;
+    switch (rand() % 5) {
+      case 0:
+        map10.insert(NAMESPACE::make_pair(key, i));
+        break;
+      case 1:
+        map10[key] += i;
+        break;
+      case 2:
+        map10.erase(key);
+        break;
+      case 3:
+        map10.insert(map10.lower_bound(rand() % 20000),
+                     NAMESPACE::make_pair(key, i));
+        break;
+      default:
+        if (map10.find(key) != map10.end()) map10.erase(map10.find(key));
+    }
+  }
+  print_map(map10);
+  const flat_map &cmap10 = map10;
+  found = 0;
+  for (int i = -1; i < 20001; ++i) {
+    found += cmap10.count(i);
+    found += cmap10.lower_bound(i) == cmap10.end() ? 1 : cmap10.lower_bound(i)->first;
+    found += cmap10.upper_bound(i) == cmap10.end() ? 1 : cmap10.upper_bound(i)->second;
+    found %= 65536;
+  }
+  std::cout << found << " " << cmap10.at(cmap10.begin()->first) << std::endl;
+  flat_map map11(map10);
+  map11.erase(map11.lower_bound(5000), map11.lower_bound(15000));
+  print_map(map11);
+  std::cout << (map10 == map11) << " " << (map10 < map11) << " "
+            << (map10 != flat_map(map10)) << std::endl;
+  size_t hash = 0;
+  for (flat_map::reverse_iterator it3 = map11.rbegin(); it3 != map11.rend();
+       ++it3)
+    hash = (hash + it3->first) * 13 % 65536;
+  std::cout << hash << std::endl;
+  std::vector<flat_map::iterator> finds;
+#if TESTSTD
+  for (size_t i = 0; i < keys.size(); ++i) finds.push_back(map10.find(keys[i]));
+#else
+  map10.find_batch(keys.begin(), keys.end(), std::back_inserter(finds));
+#endif
+  hash = 0;
+  for (size_t i = 0; i < finds.size(); ++i)
+    hash = (hash + (finds[i] == map10.end() ? 1 : finds[i]->second)) * 13 %
+           65536;
+  std::cout << hash << std::endl;
+  // Batch lookups with keys that are converted to key_type
+#if TESTSTD
+  typedef std::map<long, int> flat_long_map;
+#else
+  typedef ft::flat_map<long, int> flat_long_map;
+#endif
+  flat_long_map map12(map10.begin(), map10.end());
+  std::vector<flat_long_map::iterator> flat_long_batch_finds;
+  std::vector<flat_long_map::iterator> flat_long_bounds;
+#if TESTSTD
+  for (size_t i = 0; i < keys.size(); ++i) {
+    flat_long_batch_finds.push_back(map12.find(keys[i]));
+    flat_long_bounds.push_back(map12.lower_bound(keys[i]));
+  }
+#else
+  map12.find_batch(keys.begin(), keys.end(),
+                   std::back_inserter(flat_long_batch_finds));
+  map12.lower_bound_batch(keys.begin(), keys.end(),
+                          std::back_inserter(flat_long_bounds));
+#endif
+  found = 0;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    found += flat_long_batch_finds[i] == map12.find(keys[i]);
+    found += flat_long_bounds[i] == map12.lower_bound(keys[i]);
+  }
+  std::cout << found << std::endl;
+  std::vector<flat_long_map::iterator> flat_long_finds;
+  std::sort(keys.begin(), keys.end());
+  std::reverse(keys.begin(), keys.begin() + keys.size() / 2);
+#if TESTSTD
+  for (size_t i = 0; i < keys.size(); ++i)
+    flat_long_finds.push_back(map12.find(keys[i]));
+#else
+  map12.find_batch_sorted(keys.begin(), keys.end(),
+                          std::back_inserter(flat_long_finds));
+#endif
+  found = 0;
+  for (size_t i = 0; i < keys.size(); ++i)
+    found += flat_long_finds[i] == map12.find(keys[i]);
+  std::cout << found << std::endl;
+  map11.swap(map10);
+  map11.clear();
+  print_map(map11);
+  print_map(map10);
 }
 
 int main(void) {
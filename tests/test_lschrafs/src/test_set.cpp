@@ -1,12 +1,17 @@
 #include "include.hpp"
 
-template <class T>
-static void print_set(NAMESPACE::set<T> &set) {
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+template <class Set>
+static void print_set(Set &set) {
   if (set.empty())
     return;
   size_t hash = 0;
-  typename NAMESPACE::set<T>::iterator start = set.begin();
-  typename NAMESPACE::set<T>::iterator end = set.end();
+  typename Set::iterator start = set.begin();
+  typename Set::iterator end = set.end();
 
   while (start != end) {
     hash += (int16_t)(*start);
@@ -38,6 +43,20 @@ void test_set() {
   NAMESPACE::set<int> set2(set1.begin(), it);
   print_set(set2);
 
+  std::cout << "Range constructor (array):" << std::endl;
+  int sorted[1000];
+  int unsorted[1000];
+  for (int i = 0; i < 1000; ++i) {
+    sorted[i] = i * 7;
+    unsorted[i] = rand() % 500;
+  }
+  NAMESPACE::set<int> set_sorted(sorted, sorted + 1000);
+  print_set(set_sorted);
+  NAMESPACE::set<int> set_unsorted(unsorted, unsorted + 1000);
+  print_set(set_unsorted);
+  set_unsorted.insert(sorted, sorted + 1000);
+  print_set(set_unsorted);
+
   std::cout << "Copy constructor:" << std::endl;
   NAMESPACE::set<int> set3(set2);
   print_set(set3);
@@ -92,6 +111,51 @@ void test_set() {
   set4.erase(set4.begin(), set4.end());
   print_set(set4);
 
+  std::cout << "set::insert() with hint" << std::endl;
+  NAMESPACE::set<int> set6;
+  for (int i = 0; i < 10000; ++i) set6.insert(set6.end(), i * 3);
+  for (int i = 0; i < 10000; ++i) {
+    int tmp = rand() % 30000;
+    set6.insert(set6.upper_bound(tmp), tmp);
+    set6.insert(set6.begin(), tmp + 1);
+  }
+  print_set(set6);
+
+  std::cout << "set::find_batch() + set::lower_bound_batch()" << std::endl;
+  std::vector<int> keys;
+  for (int i = 0; i < 1000; ++i) keys.push_back(rand() % 32000);
+  for (int pass = 0; pass < 2; ++pass) {
+    if (pass == 1) std::sort(keys.begin(), keys.end());
+    std::vector<NAMESPACE::set<int>::iterator> finds;
+    std::vector<NAMESPACE::set<int>::iterator> bounds;
+#if TESTSTD
+    for (size_t i = 0; i < keys.size(); ++i) {
+      finds.push_back(set6.find(keys[i]));
+      bounds.push_back(set6.lower_bound(keys[i]));
+    }
+#else
+    if (pass == 0) {
+      set6.find_batch(keys.begin(), keys.end(), std::back_inserter(finds));
+      set6.lower_bound_batch(keys.begin(), keys.end(),
+                             std::back_inserter(bounds));
+    } else {
+      set6.find_batch_sorted(keys.begin(), keys.end(),
+                             std::back_inserter(finds));
+      set6.lower_bound_batch_sorted(keys.begin(), keys.end(),
+                                    std::back_inserter(bounds));
+    }
+#endif
+    size_t hash = 0;
+    for (size_t i = 0; i < keys.size(); ++i) {
+      hash += finds[i] == set6.end() ? 1 : *finds[i];
+      hash += bounds[i] == set6.end() ? 1 : *bounds[i];
+      hash *= 13;
+      hash %= 65536;
+    }
+    std::cout << finds.size() << " " << bounds.size() << " " << hash
+              << std::endl;
+  }
+
   // **************************************************
   // Performance
   // **************************************************
@@ -105,6 +169,117 @@ void test_set() {
   print_set(set5);
 
   set5.erase(set5.begin(), set5.end());
+
+  //**************************************************
+  // set::freeze()
+  //**************************************************
+
+  // Read-only snapshot, checked against a const std::set
+  std::cout << "set::freeze()" << std::endl;
+#if TESTSTD
+  typedef const std::set<int> frozen_set;
+  frozen_set frozen(set6);
+#else
+  typedef const ft::frozen_set<int> frozen_set;
+  frozen_set frozen = set6.freeze();
+#endif
+  size_t found = 0;
+  for (int i = -1; i < 33000; ++i) {
+    found += frozen.count(i);
+    found += frozen.find(i) == frozen.end();
+    frozen_set::iterator lower = frozen.lower_bound(i);
+    frozen_set::iterator upper = frozen.upper_bound(i);
+    found += lower == frozen.end() ? 1 : *lower;
+    found += upper == frozen.end() ? 1 : *upper;
+    found %= 65536;
+  }
+  std::cout << frozen.size() << " " << found << std::endl;
+  size_t frozen_hash = 0;
+  for (frozen_set::reverse_iterator it = frozen.rbegin(); it != frozen.rend();
+       ++it)
+    frozen_hash = (frozen_hash + *it) * 13 % 65536;
+  std::cout << frozen_hash << std::endl;
+
+  //**************************************************
+  // set::freeze() on integer keys
+  //**************************************************
+
+  // Integer keys go to a static search tree, checked at the bounds of the
+  // key type, where its padding lies
+  std::cout << "set::freeze() on integer keys" << std::endl;
+  const unsigned long max_key = std::numeric_limits<unsigned long>::max();
+  NAMESPACE::set<unsigned long> ulong_set;
+  ulong_set.insert(0);
+  ulong_set.insert(max_key);
+  ulong_set.insert(max_key - 1);
+  for (int i = 0; i < 5000; ++i)
+    ulong_set.insert(static_cast<unsigned long>(rand()) * 7919);
+#if TESTSTD
+  typedef const std::set<unsigned long> frozen_ulong_set;
+  frozen_ulong_set frozen_ulong(ulong_set);
+#else
+  typedef const ft::frozen_set<unsigned long> frozen_ulong_set;
+  frozen_ulong_set frozen_ulong = ulong_set.freeze();
+#endif
+  found = 0;
+  for (frozen_ulong_set::iterator it = frozen_ulong.begin();
+       it != frozen_ulong.end(); ++it) {
+    const unsigned long keys[] = {*it - 1, *it, *it + 1};
+    for (int i = 0; i < 3; ++i) {
+      NAMESPACE::pair<frozen_ulong_set::iterator, frozen_ulong_set::iterator>
+          range = frozen_ulong.equal_range(keys[i]);
+      found += std::distance(frozen_ulong.begin(), range.first);
+      found += std::distance(range.first, range.second) * 3;
+      found += frozen_ulong.count(keys[i]);
+      found %= 65536;
+    }
+  }
+  std::cout << frozen_ulong.size() << " " << found << std::endl;
+
+  //**************************************************
+  // ft::flat_set
+  //**************************************************
+
+  // Same interface on a sorted vector, checked against std::set
+  std::cout << "flat_set" << std::endl;
+#if TESTSTD
+  typedef std::set<int> flat_set;
+#else
+  typedef ft::flat_set<int> flat_set;
+#endif
+  std::vector<int> values;
+  for (int i = 0; i < 10000; ++i) values.push_back(rand() % 20000);
+  flat_set set7(values.begin(), values.end());
+  print_set(set7);
+  for (int i = 0; i < 20000; ++i) {
+    int key = rand() % 20000;
+    switch (rand() % 4) {
+      case 0:
+        set7.insert(key);
+        break;
+      case 1:
+        set7.erase(key);
+        break;
+      case 2:
+        set7.insert(set7.upper_bound(rand() % 20000), key);
+        break;
+      default:
+        if (set7.find(key) != set7.end()) set7.erase(set7.find(key));
+    }
+  }
+  print_set(set7);
+  std::sort(values.begin(), values.end());
+  set7.insert(values.begin(), values.begin() + 5000);
+  print_set(set7);
+  flat_set set8(set7);
+  set8.erase(set8.lower_bound(5000), set8.upper_bound(15000));
+  print_set(set8);
+  std::cout << (set7 == set8) << " " << (set8 < set7) << " "
+            << set8.count(4999) << set8.count(15001) << std::endl;
+  set8.swap(set7);
+  set8.clear();
+  print_set(set8);
+  print_set(set7);
 }
 
 int main(void) {
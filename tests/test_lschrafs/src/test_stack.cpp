@@ -44,6 +44,27 @@ void test_stack() {
   print_stack(stack2);
   print_stack(stack3);
 
+  // ft::chunked_storage has to behave like a std::vector below a stack
+#if TESTSTD
+  typedef std::vector<int> chunked;
+#else
+  typedef ft::chunked_storage<int> chunked;
+#endif
+  NAMESPACE::stack<int, chunked> stack5;
+  for (int i = 0; i < 100000; ++i) {
+    int height = stack5.size();
+    for (int j = rand() % 300; j > 0; --j) stack5.push(rand());
+    for (int j = rand() % 290; j > 0 && !stack5.empty(); --j) stack5.pop();
+    if (i % 10000 == 0) {
+      NAMESPACE::stack<int, chunked> stack6(stack5);
+      std::cout << height << " " << (stack6 == stack5) << " "
+                << (stack6 < stack5) << std::endl;
+      stack6.push(0);
+      std::cout << (stack6 > stack5) << " " << (stack6 <= stack5) << std::endl;
+    }
+  }
+  print_stack(stack5);
+
   //**************************************************
   // Performance
   //**************************************************
@@ -0,0 +1,231 @@
+#include "include.hpp"
+
+#include <string>
+#include <vector>
+
+// The order of the elements is up to the implementation, so the hash has to
+// be the same for every order
+template <class Map>
+static void print_map(Map &map) {
+  size_t hash = 0;
+  typename Map::iterator start = map.begin();
+  typename Map::iterator end = map.end();
+  size_t count = 0;
+
+  while (start != end) {
+    hash += (size_t)((*start).first) * 31 + (size_t)((*start).second);
+    ++count;
+    start++;
+  }
+
+  std::cout << "Size: " << map.size() << ", Counted: " << count
+            << ", Hash: " << hash % 65536 << std::endl;
+}
+
+void test_unordered_map() {
+  std::cout << BLUE << "UNORDERED_MAP TESTS:" << std::endl;
+
+  //**************************************************
+  // Constructors
+  //**************************************************
+  std::cout << "Normal constructor:" << std::endl;
+  NAMESPACE::unordered_map<int, int> map1;
+  for (int i = 0; i < 1000; ++i) {
+    int tmp = rand();
+    map1.insert(NAMESPACE::make_pair(tmp, i));
+  }
+  print_map(map1);
+
+  std::cout << "Range constructor:" << std::endl;
+  std::vector<NAMESPACE::pair<int, int> > pairs;
+  for (int i = 0; i < 1000; ++i)
+    pairs.push_back(NAMESPACE::make_pair(rand() % 500, i));
+  NAMESPACE::unordered_map<int, int> map2(pairs.begin(), pairs.end());
+  print_map(map2);
+
+  std::cout << "Copy constructor:" << std::endl;
+  NAMESPACE::unordered_map<int, int> map3(map2);
+  print_map(map3);
+  std::cout << (map3 == map2) << (map3 != map1) << std::endl;
+
+  std::cout << "Copy assignment operator:" << std::endl;
+  map3 = map1;
+  print_map(map3);
+  std::cout << (map3 == map1) << std::endl;
+
+  //**************************************************
+  // Element access
+  //**************************************************
+
+  int random_number = rand();
+  std::cout << "unordered_map::operator[]" << std::endl;
+  map3[random_number] = random_number;
+  std::cout << map3[random_number] << std::endl;
+  map3[random_number] = random_number + 1;
+  std::cout << map3[random_number] << std::endl;
+
+  // try_emplace() and insert_or_assign() are C++17, std::unordered_map has to
+  // emulate them with insert() and operator[]
+  std::cout << "unordered_map::try_emplace() + insert_or_assign()" << std::endl;
+  for (int i = 0; i < 1000; ++i) {
+    int key = rand() % 2000;
+#if TESTSTD
+    bool inserted = map3.insert(std::make_pair(key, i)).second;
+    if (i % 3 == 0) map3[key + 1] = i;
+#else
+    bool inserted = map3.try_emplace(key, i).second;
+    if (i % 3 == 0) map3.insert_or_assign(key + 1, i);
+#endif
+    std::cout << inserted;
+  }
+  std::cout << std::endl;
+  print_map(map3);
+
+  std::cout << "unordered_map::at()" << std::endl;
+#if TESTSTD && __cplusplus < 201103L  // TR1 has no at()
+  std::cout << map3.find(random_number)->second << std::endl;
+  std::cout << "out_of_range" << std::endl;
+#else
+  std::cout << map3.at(random_number) << std::endl;
+  try {
+    map3.at(-1);
+  } catch (std::out_of_range &) {
+    std::cout << "out_of_range" << std::endl;
+  }
+#endif
+
+  //**************************************************
+  // Modifiers
+  //**************************************************
+
+  std::cout << "unordered_map::erase()" << std::endl;
+  size_t erased = 0;
+  for (int i = 0; i < 2000; ++i) erased += map3.erase(i);
+  std::cout << erased << std::endl;
+  print_map(map3);
+
+  // Erasing while iterating visits every element once
+  NAMESPACE::unordered_map<int, int>::iterator it = map3.begin();
+  while (it != map3.end()) {
+    if ((*it).second % 2)
+      it = map3.erase(it);
+    else
+      ++it;
+  }
+  print_map(map3);
+  map3.erase(map3.begin(), map3.end());
+  print_map(map3);
+
+  std::cout << "unordered_map::clear()" << std::endl;
+  map1.clear();
+  print_map(map1);
+  for (int i = 0; i < 100; ++i) map1[i] = i;
+  print_map(map1);
+
+  std::cout << "unordered_map::swap()" << std::endl;
+  map1.swap(map2);
+  print_map(map1);
+  print_map(map2);
+  std::swap(map1, map2);
+  print_map(map1);
+
+  //**************************************************
+  // Lookup
+  //**************************************************
+
+  std::cout << "unordered_map::find() + unordered_map::count()" << std::endl;
+  size_t found = 0;
+  for (int i = 0; i < 1000; ++i) {
+    found += map2.count(i);
+    found += map2.find(i) != map2.end();
+    found += map2.equal_range(i).first != map2.equal_range(i).second;
+  }
+  std::cout << found << std::endl;
+  const NAMESPACE::unordered_map<int, int> &const_map = map2;
+  std::cout << (*const_map.find(pairs[0].first)).second << std::endl;
+
+  //**************************************************
+  // Hash policy
+  //**************************************************
+
+  // The bucket counts are up to the implementation, only the contents must
+  // survive a rehash
+  std::cout << "unordered_map::rehash() + unordered_map::max_load_factor()"
+            << std::endl;
+  NAMESPACE::unordered_map<std::string, int> map4;
+  map4.max_load_factor(0.9f);
+  std::cout << map4.max_load_factor() << std::endl;
+  for (int i = 0; i < 10000; ++i) {
+    std::string key(rand() % 10 + 1, 'a' + rand() % 26);
+    map4[key] += i;
+  }
+  std::cout << map4.size() << " " << (map4.load_factor() <= 0.9f) << std::endl;
+  map4.rehash(100000);
+  std::cout << (map4.bucket_count() >= 100000) << std::endl;
+  size_t sum = 0;
+  for (NAMESPACE::unordered_map<std::string, int>::iterator it2 = map4.begin();
+       it2 != map4.end(); ++it2)
+    sum += (*it2).first.size() * (*it2).second;
+  std::cout << sum << std::endl;
+
+  //**************************************************
+  // Performance
+  //**************************************************
+
+  NAMESPACE::unordered_map<int, int> map5;
+  for (int i = 0; i < 1000000; ++i) map5[rand()] = i;
+  print_map(map5);
+  for (int i = 0; i < 1000000; ++i) map5.erase(rand());
+  print_map(map5);
+
+  //**************************************************
+  // ft::flat_hash_map
+  //**************************************************
+
+  // Same interface on a swisstable, checked against std::unordered_map
+  std::cout << "flat_hash_map" << std::endl;
+#if TESTSTD
+  typedef std::unordered_map<int, int> flat_map;
+#else
+  typedef ft::flat_hash_map<int, int> flat_map;
+#endif
+  flat_map map6;
+  map6.max_load_factor(0.875f);
+  for (int i = 0; i < 100000; ++i) {
+    int key = rand() % 50000;
+    switch (rand() % 4) {
+      case 0:
+        map6.insert(NAMESPACE::make_pair(key, i));
+        break;
+      case 1:
+        map6[key] += i;
+        break;
+      case 2:
+        map6.erase(key);
+        break;
+      default:
+        if (map6.find(key) != map6.end()) map6.erase(map6.find(key));
+    }
+  }
+  print_map(map6);
+  flat_map map7(map6);
+  found = 0;
+  for (int i = 0; i < 50000; ++i) found += map7.count(i);
+  std::cout << found << " " << (map6 == map7) << std::endl;
+  for (flat_map::iterator it3 = map7.begin(); it3 != map7.end();) {
+    if ((*it3).first % 3)
+      it3 = map7.erase(it3);
+    else
+      ++it3;
+  }
+  print_map(map7);
+  map7.swap(map6);
+  map7.clear();
+  print_map(map7);
+  print_map(map6);
+}
+
+int main(void) {
+  srand(2);  // Set the seed
+  test_unordered_map();
+}
@@ -0,0 +1,134 @@
+#include "include.hpp"
+
+#include <string>
+
+// The order of the keys is up to the implementation, so the hash has to be the
+// same for every order
+template <class Set>
+static void print_set(Set &set) {
+  size_t hash = 0;
+  typename Set::iterator start = set.begin();
+  typename Set::iterator end = set.end();
+  size_t count = 0;
+
+  while (start != end) {
+    hash += (size_t)(*start);
+    ++count;
+    start++;
+  }
+
+  std::cout << "Size: " << set.size() << ", Counted: " << count
+            << ", Hash: " << hash % 65536 << std::endl;
+}
+
+void test_unordered_set() {
+  std::cout << MAGENTA << "UNORDERED_SET TESTS:" << std::endl;
+
+  //**************************************************
+  // Constructors
+  //**************************************************
+  std::cout << "Normal constructor:" << std::endl;
+  NAMESPACE::unordered_set<int> set1;
+  for (int i = 0; i < 1000; ++i) std::cout << set1.insert(rand() % 700).second;
+  std::cout << std::endl;
+  print_set(set1);
+
+  std::cout << "Range constructor (array):" << std::endl;
+  int unsorted[1000];
+  for (int i = 0; i < 1000; ++i) unsorted[i] = rand() % 500;
+  NAMESPACE::unordered_set<int> set2(unsorted, unsorted + 1000);
+  print_set(set2);
+  set2.insert(unsorted, unsorted + 1000);
+  print_set(set2);
+
+  std::cout << "Copy constructor + assignment operator:" << std::endl;
+  NAMESPACE::unordered_set<int> set3(set2);
+  print_set(set3);
+  std::cout << (set3 == set2) << (set3 == set1) << std::endl;
+  set3 = set1;
+  print_set(set3);
+
+  //**************************************************
+  // Modifiers
+  //**************************************************
+
+  std::cout << "unordered_set::erase()" << std::endl;
+  size_t erased = 0;
+  for (int i = 0; i < 1000; i += 3) erased += set3.erase(i);
+  std::cout << erased << std::endl;
+  print_set(set3);
+  NAMESPACE::unordered_set<int>::iterator it = set3.begin();
+  while (it != set3.end()) {
+    if (*it % 2)
+      it = set3.erase(it);
+    else
+      ++it;
+  }
+  print_set(set3);
+  set3.clear();
+  print_set(set3);
+  set3.insert(42);
+  print_set(set3);
+
+  //**************************************************
+  // Lookup
+  //**************************************************
+
+  std::cout << "unordered_set::find() + unordered_set::count()" << std::endl;
+  size_t found = 0;
+  for (int i = 0; i < 1000; ++i)
+    found += set1.count(i) + (set1.find(i) != set1.end());
+  std::cout << found << std::endl;
+
+  NAMESPACE::unordered_set<std::string> set4;
+  for (int i = 0; i < 10000; ++i)
+    set4.insert(std::string(rand() % 10 + 1, 'a' + rand() % 26));
+  set4.rehash(0);
+  size_t length = 0;
+  for (NAMESPACE::unordered_set<std::string>::iterator it2 = set4.begin();
+       it2 != set4.end(); ++it2)
+    length += it2->size();
+  std::cout << set4.size() << " " << length << " " << set4.count("aaa")
+            << std::endl;
+
+  //**************************************************
+  // Performance
+  //**************************************************
+
+  NAMESPACE::unordered_set<int> set5;
+  for (int i = 0; i < 1000000; ++i) set5.insert(rand());
+  print_set(set5);
+  for (int i = 0; i < 1000000; ++i) set5.erase(rand());
+  print_set(set5);
+
+  //**************************************************
+  // ft::flat_hash_set
+  //**************************************************
+
+  std::cout << "flat_hash_set" << std::endl;
+#if TESTSTD
+  typedef std::unordered_set<int> flat_set;
+#else
+  typedef ft::flat_hash_set<int> flat_set;
+#endif
+  flat_set set6;
+  for (int i = 0; i < 100000; ++i) {
+    if (rand() % 3)
+      set6.insert(rand() % 30000);
+    else
+      set6.erase(rand() % 30000);
+  }
+  print_set(set6);
+  flat_set set7(set6.begin(), set6.end());
+  std::cout << (set6 == set7) << std::endl;
+  set7.erase(set7.begin(), set7.end());
+  print_set(set7);
+  found = 0;
+  for (int i = 0; i < 30000; ++i) found += set6.count(i);
+  std::cout << found << std::endl;
+}
+
+int main(void) {
+  srand(2);  // Set the seed
+  test_unordered_set();
+}
@@ -1,7 +1,11 @@
 #include "include.hpp"
 
-template <class T>
-static void print_vector(NAMESPACE::vector<T> &vec) {
+#include <iterator>
+#include <sstream>
+#include <string>
+
+template <class T, class Allocator>
+static void print_vector(NAMESPACE::vector<T, Allocator> &vec) {
   size_t hash = 0;
   size_t size = vec.size();
   for (size_t i = 0; i < size; ++i) {
@@ -112,10 +116,194 @@ void test_vector() {
   vec1.resize(42);
   print_vector(vec1);
 
+  // shrink_to_fit() is C++11 and trim() is ft only, std::vector has to shrink
+  // by swapping with a copy
+  std::cout << "vector::shrink_to_fit() + vector::trim()" << std::endl;
+  NAMESPACE::vector<int> vec14(vec1);
+  vec14.reserve(1000);
+  for (int i = 0; i < 3; ++i) {
+#if TESTSTD
+    bool trimmed = vec14.capacity() - vec14.size() > 0.5 * vec14.capacity();
+    if (trimmed) NAMESPACE::vector<int>(vec14).swap(vec14);
+    size_t usage = vec14.capacity() * sizeof(int);
+#else
+    bool trimmed = vec14.trim();
+    size_t usage = vec14.memory_usage();
+#endif
+    std::cout << trimmed << " " << vec14.capacity() << " " << usage
+              << std::endl;
+    vec14.push_back(i);
+  }
+  vec14.erase(vec14.begin(), vec14.begin() + 10);
+#if TESTSTD
+  NAMESPACE::vector<int>(vec14).swap(vec14);
+#else
+  vec14.shrink_to_fit();
+#endif
+  std::cout << vec14.capacity() << std::endl;
+  print_vector(vec14);
+  vec14.clear();
+#if TESTSTD
+  NAMESPACE::vector<int>().swap(vec14);
+#else
+  vec14.shrink_to_fit();
+#endif
+  std::cout << vec14.capacity() << std::endl;
+
   std::cout << "vector::swap()" << std::endl;
   vec1.swap(vec2);
   print_vector(vec1);
 
+  std::cout << "vector<double> + vector<vector<int> >" << std::endl;
+  NAMESPACE::vector<double> vec6;
+  for (int i = 0; i < 1000; ++i)
+    vec6.insert(vec6.begin() + (i ? rand() % i : 0), i * 1.5);
+  vec6.insert(vec6.begin() + 20, 5, vec6[30]);
+  vec6.erase(vec6.begin() + 10, vec6.begin() + 100);
+  vec6.erase(vec6.begin() + 3);
+  vec6.resize(2000, 2.5);
+  print_vector(vec6);
+  NAMESPACE::vector<NAMESPACE::vector<int> > vec7;
+  for (int i = 0; i < 1000; ++i)
+    vec7.push_back(NAMESPACE::vector<int>(i % 10, i));
+  vec7.insert(vec7.begin() + 5, vec7[100]);
+  vec7.insert(vec7.begin() + 50, vec7.begin() + 200, vec7.begin() + 300);
+  vec7.erase(vec7.begin(), vec7.begin() + 20);
+  NAMESPACE::vector<int> vec8;
+  for (size_t i = 0; i < vec7.size(); ++i)
+    vec8.push_back(vec7[i].empty() ? -1 : vec7[i].back() + vec7[i].size());
+  print_vector(vec8);
+
+  // Objects of the vector itself as the value, also while it reallocates
+  std::cout << "vector<std::string> inserting its own objects" << std::endl;
+  NAMESPACE::vector<std::string> vec9(1, "a");
+  for (int i = 0; i < 200; ++i) {
+    vec9.push_back(vec9[rand() % vec9.size()] + "b");
+    vec9.push_back(vec9[rand() % vec9.size()]);
+    size_t pos = rand() % vec9.size();
+    vec9.insert(vec9.begin() + pos, rand() % 3, vec9[rand() % vec9.size()]);
+    vec9.insert(vec9.begin() + pos, vec9[rand() % vec9.size()]);
+    if (i % 4 == 0) vec9.erase(vec9.begin() + rand() % vec9.size());
+  }
+  NAMESPACE::vector<int> vec10;
+  for (size_t i = 0; i < vec9.size(); ++i)
+    vec10.push_back(vec9[i].size());
+  print_vector(vec10);
+
+  // std::vector has no growth policy, it grows like ft::growth_double
+  std::cout << "vector with growth policies" << std::endl;
+#if TESTSTD
+  typedef std::vector<int> golden_vector;
+  typedef std::vector<int> size_class_vector;
+#else
+  typedef ft::vector<int, std::allocator<int>, ft::growth_golden> golden_vector;
+  typedef ft::vector<int, std::allocator<int>,
+                     ft::growth_size_class<ft::growth_one_and_a_half> >
+      size_class_vector;
+#endif
+  golden_vector vec11;
+  size_class_vector vec12;
+  for (int i = 0; i < 10000; ++i) {
+    vec11.push_back(i);
+    vec12.insert(vec12.begin() + rand() % (vec12.size() + 1), 3, i);
+    if (i % 100 == 0) vec11.resize(vec11.size() + 7, i);
+  }
+  vec12.insert(vec12.begin() + 5, vec11.begin(), vec11.end());
+  std::cout << (vec11.capacity() >= vec11.size()) << " "
+            << (vec12.capacity() >= vec12.size()) << std::endl;
+  NAMESPACE::vector<int> vec13(vec11.begin(), vec11.end());
+  vec13.insert(vec13.end(), vec12.begin(), vec12.end());
+  print_vector(vec13);
+
+  // ft::small_vector has to behave like a std::vector
+  std::cout << "small_vector" << std::endl;
+#if TESTSTD
+  typedef std::vector<std::string> small_vector;
+#else
+  typedef ft::small_vector<std::string, 4> small_vector;
+#endif
+  small_vector vec15;
+  small_vector vec16(2, "b");
+  for (int i = 0; i < 100; ++i) {
+    std::string value(rand() % 5 + 1, 'a' + i % 26);
+    if (vec15.size() > 6) vec15.erase(vec15.begin() + rand() % 3, vec15.end());
+    vec15.insert(vec15.begin() + rand() % (vec15.size() + 1), value);
+    if (i % 3 == 0) vec15.push_back(vec15[rand() % vec15.size()]);
+    if (i % 7 == 0) vec15.resize(vec15.size() / 2, value);
+    if (i % 5 == 0) vec15.swap(vec16);
+    if (i % 11 == 0) vec16 = small_vector(vec15.begin(), vec15.end());
+  }
+  NAMESPACE::vector<int> vec17;
+  for (size_t i = 0; i < vec15.size(); ++i) vec17.push_back(vec15[i][0]);
+  for (size_t i = 0; i < vec16.size(); ++i) vec17.push_back(vec16[i].size());
+  print_vector(vec17);
+  // Memory from a copy of the allocator never is the inline buffer
+  small_vector vec_alloc(2, "c");
+  small_vector::allocator_type alloc = vec_alloc.get_allocator();
+  std::string* strings = alloc.allocate(2);
+  alloc.construct(strings + 1, "d");
+  std::cout << vec_alloc[1] << " " << strings[1] << std::endl;
+  alloc.destroy(strings + 1);
+  alloc.deallocate(strings, 2);
+
+  // Buffers of 4 kB and more are mapped and grown with mremap
+  std::cout << "mmap_allocator" << std::endl;
+  NAMESPACE::vector<int, ft::mmap_allocator<int, 4096> > vec18;
+  for (int i = 0; i < 20000; ++i) {
+    vec18.push_back(i);
+    if (i % 1000 == 0) vec18.push_back(vec18[rand() % vec18.size()]);
+    if (i % 3000 == 0) vec18.resize(vec18.size() + 500, i);
+    if (i % 7000 == 0) vec18.reserve(vec18.capacity() * 3);
+  }
+  vec18.erase(vec18.begin() + 100, vec18.end() - 100);
+  NAMESPACE::vector<int, ft::mmap_allocator<int, 4096> > vec19(vec18);
+  vec19.insert(vec19.begin(), 3000, 7);
+  print_vector(vec18);
+  print_vector(vec19);
+
+  // New objects are written right after being appended uninitialized
+  std::cout << "resize_default_init" << std::endl;
+  NAMESPACE::vector<int> vec20(3, 1);
+  NAMESPACE::vector<std::string> vec21(2, "a");
+  for (int i = 0; i < 50; ++i) {
+    size_t size = vec20.size();
+    size_t n = rand() % 100;
+#if TESTSTD
+    vec20.resize(size + n);
+    int* tail = &vec20[size];
+    vec21.resize(vec21.size() + 1);
+#else
+    int* tail = vec20.append_uninitialized(n);
+    if (i % 2) vec20.resize_default_init(size + n);
+    vec21.resize_default_init(vec21.size() + 1);
+#endif
+    for (size_t j = 0; j < n; ++j) tail[j] = rand();
+    if (i % 9 == 0) vec20.resize(vec20.size() / 3);
+  }
+  print_vector(vec20);
+  std::cout << vec21.size() << " " << vec21.back().size() << std::endl;
+
+  // Ranges that can only be read once
+  std::cout << "insert input iterators" << std::endl;
+  NAMESPACE::vector<int> vec22(5, 2);
+  NAMESPACE::vector<std::string> vec23(3, "x");
+  for (int i = 0; i < 30; ++i) {
+    std::stringstream numbers;
+    for (int j = rand() % 20; j > 0; --j) numbers << rand() % 1000 << " ";
+    std::stringstream words(numbers.str());
+    size_t position = rand() % (vec22.size() + 1);
+    if (i % 4 == 0) position = vec22.size();
+    vec22.insert(vec22.begin() + position, std::istream_iterator<int>(numbers),
+                 std::istream_iterator<int>());
+    vec23.insert(vec23.begin() + position % (vec23.size() + 1),
+                 std::istream_iterator<std::string>(words),
+                 std::istream_iterator<std::string>());
+  }
+  print_vector(vec22);
+  NAMESPACE::vector<int> vec24;
+  for (size_t i = 0; i < vec23.size(); ++i) vec24.push_back(vec23[i].size());
+  print_vector(vec24);
+
   //**************************************************
   // Performance
   //**************************************************
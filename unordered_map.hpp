@@ -0,0 +1,86 @@
+#ifndef UNORDERED_MAP_H
+#define UNORDERED_MAP_H
+
+#include "hashtable.hpp"
+#include "unordered_map_base.hpp"
+#include "utilities.hpp"
+
+namespace ft {
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::unordered_map
+//
+// Key-value container without an order, for lookups that don't need one.
+// Backed by an open addressing hashtable: the values live in one array, a
+// lookup hashes the key and walks a few neighbouring slots instead of
+// descending a tree of separately allocated nodes.
+//
+// Unlike std::unordered_map, every insert may move the values, so a rehash
+// invalidates references to them as well as iterators. Erasing only
+// invalidates the erased element.
+//////////////////////////////////////////////////////////////////////////////
+
+template <class Key, class T, class Hash = ft::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<ft::pair<const Key, T> > >
+class unordered_map
+    : public unordered_map_base<
+          Key, T, Hash, KeyEqual, Allocator,
+          hashtable<ft::pair<const Key, T>, Hash, KeyEqual, Allocator,
+                    ft::select_first<ft::pair<const Key, T> > > > {
+  typedef unordered_map_base<
+      Key, T, Hash, KeyEqual, Allocator,
+      hashtable<ft::pair<const Key, T>, Hash, KeyEqual, Allocator,
+                ft::select_first<ft::pair<const Key, T> > > >
+      base_type;
+
+ public:
+  typedef typename base_type::size_type size_type;
+
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  unordered_map() : base_type(0, Hash(), KeyEqual(), Allocator()) {}
+
+  explicit unordered_map(size_type bucket_count, const Hash& hash = Hash(),
+                         const KeyEqual& equal = KeyEqual(),
+                         const Allocator& alloc = Allocator())
+      : base_type(bucket_count, hash, equal, alloc) {}
+
+  template <class InputIt>
+  unordered_map(InputIt first, InputIt last, size_type bucket_count = 0,
+                const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(),
+                const Allocator& alloc = Allocator())
+      : base_type(bucket_count, hash, equal, alloc) {
+    this->insert(first, last);
+  }
+
+  unordered_map(const unordered_map& other) : base_type(other) {}
+
+  ~unordered_map() {}
+
+  //**************************************************
+  // Operator overloads
+  //**************************************************
+
+  unordered_map& operator=(const unordered_map& other) {
+    base_type::operator=(other);
+    return *this;
+  }
+};
+
+}  // namespace ft
+
+namespace std {
+
+// Specialization of the std::swap function
+template <class Key, class T, class Hash, class KeyEqual, class Alloc>
+void swap(ft::unordered_map<Key, T, Hash, KeyEqual, Alloc>& lhs,
+          ft::unordered_map<Key, T, Hash, KeyEqual, Alloc>& rhs) {
+  lhs.swap(rhs);
+}
+
+}  // namespace std
+
+#endif  // UNORDERED_MAP_H
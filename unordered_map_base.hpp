@@ -0,0 +1,292 @@
+#ifndef UNORDERED_MAP_BASE_H
+#define UNORDERED_MAP_BASE_H
+
+#include "iterator_hashtable.hpp"
+#include "utilities.hpp"
+
+namespace ft {
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::unordered_map_base
+//
+// Everything ft::unordered_map and ft::flat_hash_map have in common, on top of
+// a Table of ft::pair<const Key, T> with the interface of ft::hashtable: the
+// slots are addressed by index and iterated by ft::iterator_hash. The two
+// containers only pick the table and add their constructors.
+//////////////////////////////////////////////////////////////////////////////
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator,
+          class Table>
+class unordered_map_base {
+ public:
+  //**************************************************
+  // Typedefs
+  //**************************************************
+
+  typedef Key key_type;
+  typedef T mapped_type;
+  typedef ft::pair<const Key, T> value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Hash hasher;
+  typedef KeyEqual key_equal;
+  typedef Allocator allocator_type;
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef typename Allocator::pointer pointer;
+  typedef typename Allocator::const_pointer const_pointer;
+
+  typedef Table table_type;
+
+  typedef iterator_hash<value_type> iterator;
+  typedef iterator_hash<const value_type> const_iterator;
+
+  //**************************************************
+  // Member functions
+  //**************************************************
+
+  allocator_type get_allocator() const { return table_.get_allocator(); }
+
+  //**************************************************
+  // Element access
+  //**************************************************
+
+  mapped_type& at(const Key& key) {
+    iterator ret = find(key);
+    if (ret == end()) throw std::out_of_range("No element with key found");
+    return (*ret).second;
+  }
+
+  const mapped_type& at(const Key& key) const {
+    const_iterator ret = find(key);
+    if (ret == end()) throw std::out_of_range("No element with key found");
+    return (*ret).second;
+  }
+
+  mapped_type& operator[](const Key& key) {
+    return (*try_emplace(key).first).second;
+  }
+
+  //**************************************************
+  // Iterators
+  //**************************************************
+
+  iterator begin() { return table_.begin(); }
+  const_iterator begin() const { return table_.begin(); }
+  iterator end() { return table_.end(); }
+  const_iterator end() const { return table_.end(); }
+
+  //**************************************************
+  // Capacity
+  //**************************************************
+
+  bool empty() const { return (size() == 0); }
+  size_type size() const { return table_.size(); }
+  size_type max_size() const { return table_.max_size(); }
+
+  //**************************************************
+  // Modifiers
+  //**************************************************
+
+  void clear() { table_.clear(); }
+
+  ft::pair<iterator, bool> insert(const value_type& value) {
+    ft::pair<size_type, bool> tmp = table_.insert(value);
+    return ft::pair<iterator, bool>(table_.iterator_at(tmp.first), tmp.second);
+  }
+
+  /**
+   * @brief Inserts a value-initialized element with key if there is none yet.
+   * The table is probed once and the element is only built if it is missing
+   *
+   * @param key
+   * @return ft::pair<iterator, bool> iterator to the element with key and
+   * whether it was inserted
+   */
+  ft::pair<iterator, bool> try_emplace(const key_type& key) {
+    ft::pair<size_type, bool> position = table_.find_position(key);
+    if (position.second)
+      return ft::pair<iterator, bool>(table_.iterator_at(position.first),
+                                      false);
+    return ft::pair<iterator, bool>(
+        table_.iterator_at(
+            table_.insert_at(position.first, value_type(key, mapped_type()))),
+        true);
+  }
+
+  /**
+   * @brief Inserts (key, obj) if there is no element with key yet. obj is only
+   * copied if the element is inserted
+   *
+   * @param key
+   * @param obj
+   * @return ft::pair<iterator, bool> iterator to the element with key and
+   * whether it was inserted
+   */
+  ft::pair<iterator, bool> try_emplace(const key_type& key,
+                                       const mapped_type& obj) {
+    ft::pair<size_type, bool> position = table_.find_position(key);
+    if (position.second)
+      return ft::pair<iterator, bool>(table_.iterator_at(position.first),
+                                      false);
+    return ft::pair<iterator, bool>(
+        table_.iterator_at(
+            table_.insert_at(position.first, value_type(key, obj))),
+        true);
+  }
+
+  /**
+   * @brief Assigns obj to the element with key, or inserts (key, obj) if there
+   * is none. The table is probed once
+   *
+   * @param key
+   * @param obj
+   * @return ft::pair<iterator, bool> iterator to the element with key and
+   * whether it was inserted
+   */
+  ft::pair<iterator, bool> insert_or_assign(const key_type& key,
+                                            const mapped_type& obj) {
+    ft::pair<size_type, bool> position = table_.find_position(key);
+    if (position.second) {
+      iterator it = table_.iterator_at(position.first);
+      it->second = obj;
+      return ft::pair<iterator, bool>(it, false);
+    }
+    return ft::pair<iterator, bool>(
+        table_.iterator_at(
+            table_.insert_at(position.first, value_type(key, obj))),
+        true);
+  }
+
+  // The hint is of no use without an order, it is ignored
+  iterator insert(const_iterator hint, const value_type& value) {
+    (void)hint;
+    return insert(value).first;
+  }
+
+  template <class InputIt>
+  void insert(InputIt first, InputIt last) {
+    table_.insert_range(first, last);
+  }
+
+  iterator erase(const_iterator pos) {
+    return table_.iterator_at(table_.erase_at(table_.index_of(pos)));
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    size_type end = table_.index_of(last);
+    table_.erase(table_.index_of(first), end);
+    return table_.iterator_at(end);
+  }
+
+  size_type erase(const Key& key) {
+    bool erased = table_.erase(key);
+    return erased;
+  }
+
+  void swap(unordered_map_base& other) { table_.swap(other.table_); }
+
+  //**************************************************
+  // Lookup
+  //**************************************************
+
+  size_type count(const Key& key) const {
+    return table_.find_position(key).second ? 1 : 0;
+  }
+
+  iterator find(const Key& key) {
+    return table_.iterator_at(table_.find(key));
+  }
+
+  const_iterator find(const Key& key) const {
+    return table_.iterator_at(table_.find(key));
+  }
+
+  ft::pair<iterator, iterator> equal_range(const Key& key) {
+    iterator first = find(key);
+    iterator last = first;
+    if (last != end()) ++last;
+    return ft::make_pair(first, last);
+  }
+  ft::pair<const_iterator, const_iterator> equal_range(const Key& key) const {
+    const_iterator first = find(key);
+    const_iterator last = first;
+    if (last != end()) ++last;
+    return ft::make_pair(first, last);
+  }
+
+  //**************************************************
+  // Hash policy
+  //**************************************************
+
+  size_type bucket_count() const { return table_.bucket_count(); }
+  float load_factor() const { return table_.load_factor(); }
+  float max_load_factor() const { return table_.max_load_factor(); }
+  void max_load_factor(float ml) { table_.max_load_factor(ml); }
+  void rehash(size_type count) { table_.rehash(count); }
+  void reserve(size_type count) { table_.reserve(count); }
+
+  //**************************************************
+  // Observers
+  //**************************************************
+
+  hasher hash_function() const { return table_.hash_function(); }
+  key_equal key_eq() const { return table_.key_eq(); }
+
+ protected:
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  unordered_map_base(size_type bucket_count, const Hash& hash,
+                     const KeyEqual& equal, const Allocator& alloc)
+      : table_(bucket_count, hash, equal, alloc) {}
+
+  unordered_map_base(const unordered_map_base& other) : table_(other.table_) {}
+
+  ~unordered_map_base() {}
+
+  //**************************************************
+  // Operator overloads
+  //**************************************************
+
+  unordered_map_base& operator=(const unordered_map_base& other) {
+    table_ = other.table_;
+    return *this;
+  }
+
+ private:
+  table_type table_;
+};
+
+//**************************************************
+// Non-member functions
+//**************************************************
+
+// Equal if both hold the same elements, in whatever order
+template <class Key, class T, class Hash, class KeyEqual, class Alloc,
+          class Table>
+bool operator==(
+    const ft::unordered_map_base<Key, T, Hash, KeyEqual, Alloc, Table>& lhs,
+    const ft::unordered_map_base<Key, T, Hash, KeyEqual, Alloc, Table>& rhs) {
+  if (lhs.size() != rhs.size()) return false;
+  typedef typename ft::unordered_map_base<Key, T, Hash, KeyEqual, Alloc,
+                                          Table>::const_iterator const_iterator;
+  for (const_iterator it = lhs.begin(); it != lhs.end(); ++it) {
+    const_iterator other = rhs.find(it->first);
+    if (other == rhs.end() || !(other->second == it->second)) return false;
+  }
+  return true;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Alloc,
+          class Table>
+bool operator!=(
+    const ft::unordered_map_base<Key, T, Hash, KeyEqual, Alloc, Table>& lhs,
+    const ft::unordered_map_base<Key, T, Hash, KeyEqual, Alloc, Table>& rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace ft
+
+#endif  // UNORDERED_MAP_BASE_H
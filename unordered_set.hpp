@@ -0,0 +1,77 @@
+#ifndef UNORDERED_SET_H
+#define UNORDERED_SET_H
+
+#include "hashtable.hpp"
+#include "unordered_set_base.hpp"
+#include "utilities.hpp"
+
+namespace ft {
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::unordered_set
+//
+// Set of keys without an order, backed by the same open addressing hashtable
+// as ft::unordered_map. A rehash invalidates iterators and references, an
+// erase only those to the erased key.
+//////////////////////////////////////////////////////////////////////////////
+
+template <class Key, class Hash = ft::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<Key> >
+class unordered_set
+    : public unordered_set_base<Key, Hash, KeyEqual, Allocator,
+                                hashtable<Key, Hash, KeyEqual, Allocator> > {
+  typedef unordered_set_base<Key, Hash, KeyEqual, Allocator,
+                             hashtable<Key, Hash, KeyEqual, Allocator> >
+      base_type;
+
+ public:
+  typedef typename base_type::size_type size_type;
+
+  //**************************************************
+  // Constructors
+  //**************************************************
+
+  unordered_set() : base_type(0, Hash(), KeyEqual(), Allocator()) {}
+
+  explicit unordered_set(size_type bucket_count, const Hash& hash = Hash(),
+                         const KeyEqual& equal = KeyEqual(),
+                         const Allocator& alloc = Allocator())
+      : base_type(bucket_count, hash, equal, alloc) {}
+
+  template <class InputIt>
+  unordered_set(InputIt first, InputIt last, size_type bucket_count = 0,
+                const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(),
+                const Allocator& alloc = Allocator())
+      : base_type(bucket_count, hash, equal, alloc) {
+    this->insert(first, last);
+  }
+
+  unordered_set(const unordered_set& other) : base_type(other) {}
+
+  ~unordered_set() {}
+
+  //**************************************************
+  // Operator overloads
+  //**************************************************
+
+  unordered_set& operator=(const unordered_set& other) {
+    base_type::operator=(other);
+    return *this;
+  }
+};
+
+}  // namespace ft
+
+namespace std {
+
+// Specialization of the std::swap function
+template <class Key, class Hash, class KeyEqual, class Alloc>
+void swap(ft::unordered_set<Key, Hash, KeyEqual, Alloc>& lhs,
+          ft::unordered_set<Key, Hash, KeyEqual, Alloc>& rhs) {
+  lhs.swap(rhs);
+}
+
+}  // namespace std
+
+#endif  // UNORDERED_SET_H
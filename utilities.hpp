@@ -10,6 +10,14 @@
 // ft::make_pair
 // other helpers:
 // ft::is_same
+// ft::is_trivially_relocatable
+// ft::is_trivially_default_constructible
+// ft::has_default_construct
+// ft::has_reallocate
+// ft::move, ft::move_if_noexcept
+// ft::identity
+// ft::select_first
+// ft::hash
 //////////////////////////////////////////////////////////////////////////////
 
 #ifndef UTILITIES_H
@@ -22,7 +30,9 @@
 #include <limits>
 #include <memory>
 #include <stdexcept>
+#include <string>
 #include <typeinfo>
+#include <utility>
 
 namespace ft {
 
@@ -415,6 +425,8 @@ struct pair {
 
   pair(const first_type& x, const second_type& y) : first(x), second(y) {}
 
+  pair(const pair& other) : first(other.first), second(other.second) {}
+
   template <class U, class V>
   pair(const pair<U, V>& other) : first(other.first), second(other.second) {}
 
@@ -506,6 +518,226 @@ struct is_const : false_type {};
 template <class T>
 struct is_const<const T> : true_type {};
 
+//////////////////////////////////////////////////////////////////////////////
+// ft::is_trivially_relocatable
+//////////////////////////////////////////////////////////////////////////////
+
+// True if an object can be moved to another address by copying its bytes,
+// after which the old bytes are simply forgotten (no destructor runs there).
+// ft::vector then grows, inserts and erases with memcpy/memmove. Holds for
+// arithmetic types, enums, pointers and plain structs. Other types that don't
+// point into themselves can opt in:
+// template <> struct is_trivially_relocatable<T> : public ft::true_type {};
+#if defined(__GNUC__) || defined(__clang__)
+template <class T>
+struct is_trivially_relocatable : public integral_constant<bool, __is_pod(T)> {
+};
+#else
+// Without the __is_pod builtin only fundamental types are detected
+template <class T>
+struct is_trivially_relocatable
+    : public integral_constant<bool, is_integral<T>::value> {};
+template <>
+struct is_trivially_relocatable<float> : public true_type {};
+template <>
+struct is_trivially_relocatable<double> : public true_type {};
+template <>
+struct is_trivially_relocatable<long double> : public true_type {};
+template <class T>
+struct is_trivially_relocatable<T*> : public true_type {};
+#endif
+
+// ft::pair has constructors and so is never a POD, but it is relocatable if
+// both of its members are
+template <class T1, class T2>
+struct is_trivially_relocatable<ft::pair<T1, T2> >
+    : public integral_constant<bool, is_trivially_relocatable<T1>::value &&
+                                         is_trivially_relocatable<T2>::value> {
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::is_trivially_default_constructible
+//////////////////////////////////////////////////////////////////////////////
+
+// True if default-initializing an object leaves its bytes as they are, so
+// ft::vector::resize_default_init may skip building it. Clang deprecates
+// __has_trivial_constructor, it is only used by GCCs that lack the newer
+// builtin
+#if defined(__clang__)
+#define FT_IS_TRIVIALLY_CONSTRUCTIBLE
+#elif defined(__has_builtin)
+#if __has_builtin(__is_trivially_constructible)
+#define FT_IS_TRIVIALLY_CONSTRUCTIBLE
+#endif
+#endif
+
+#if defined(FT_IS_TRIVIALLY_CONSTRUCTIBLE)
+template <class T>
+struct is_trivially_default_constructible
+    : public integral_constant<bool, __is_trivially_constructible(T)> {};
+#elif defined(__GNUC__)
+template <class T>
+struct is_trivially_default_constructible
+    : public integral_constant<bool, __has_trivial_constructor(T)> {};
+#else
+template <class T>
+struct is_trivially_default_constructible
+    : public integral_constant<bool, is_integral<T>::value> {};
+template <>
+struct is_trivially_default_constructible<float> : public true_type {};
+template <>
+struct is_trivially_default_constructible<double> : public true_type {};
+template <>
+struct is_trivially_default_constructible<long double> : public true_type {};
+template <class T>
+struct is_trivially_default_constructible<T*> : public true_type {};
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::has_default_construct
+//////////////////////////////////////////////////////////////////////////////
+
+// True if Allocator::construct() and destroy() do nothing but build and
+// destroy the object, like std::allocator's. Only then may ft::vector move
+// trivially relocatable objects bytewise, without asking the allocator
+template <class Allocator>
+struct has_default_construct : public false_type {};
+
+template <class T>
+struct has_default_construct<std::allocator<T> > : public true_type {};
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::has_reallocate
+//////////////////////////////////////////////////////////////////////////////
+
+// True if the allocator can resize a buffer in place of allocating a new one:
+//   pointer reallocate(pointer p, size_type old_n, size_type new_n);
+// keeps the bytes of the objects, returns the (possibly moved) buffer or NULL
+// if it can't. See ft::mmap_allocator
+template <class Allocator>
+struct has_reallocate : public false_type {};
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::move, ft::move_if_noexcept
+//////////////////////////////////////////////////////////////////////////////
+
+// The containers move objects with these, so a C++11 build moves where a
+// C++98 build (which has no rvalue references) copies
+#if __cplusplus >= 201103L
+using std::move;
+using std::move_if_noexcept;
+#else
+template <class T>
+T& move(T& value) {
+  return value;
+}
+
+template <class T>
+const T& move_if_noexcept(T& value) {
+  return value;
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::identity
+//////////////////////////////////////////////////////////////////////////////
+
+// Key extractor for containers whose value is the key itself (set)
+template <class T>
+struct identity {
+  typedef T argument_type;
+  typedef T result_type;
+
+  const result_type& operator()(const argument_type& value) const {
+    return value;
+  }
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::select_first
+//////////////////////////////////////////////////////////////////////////////
+
+// Key extractor for containers that store key-value pairs (map)
+template <class Pair>
+struct select_first {
+  typedef Pair argument_type;
+  typedef typename Pair::first_type result_type;
+
+  const result_type& operator()(const argument_type& value) const {
+    return value.first;
+  }
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// ft::hash
+//////////////////////////////////////////////////////////////////////////////
+
+// Hash functor of the unordered containers. Integers and enums are their own
+// hash, the containers mix the bits before using them. Other types need a
+// specialization:
+// template <> struct hash<T> { std::size_t operator()(const T&) const; };
+template <class T>
+struct hash {
+  typedef T argument_type;
+  typedef std::size_t result_type;
+
+  std::size_t operator()(const T& value) const {
+    return static_cast<std::size_t>(value);
+  }
+};
+
+template <class T>
+struct hash<T*> {
+  typedef T* argument_type;
+  typedef std::size_t result_type;
+
+  std::size_t operator()(T* value) const {
+    return reinterpret_cast<std::size_t>(value);
+  }
+};
+
+// FNV-1a over the bytes of an object
+inline std::size_t hash_bytes(const void* data, std::size_t length) {
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  std::size_t hash = static_cast<std::size_t>(2166136261U);
+  for (std::size_t i = 0; i < length; ++i) {
+    hash ^= bytes[i];
+    hash *= static_cast<std::size_t>(16777619U);
+  }
+  return hash;
+}
+
+template <>
+struct hash<std::string> {
+  typedef std::string argument_type;
+  typedef std::size_t result_type;
+
+  std::size_t operator()(const std::string& value) const {
+    return hash_bytes(value.data(), value.size());
+  }
+};
+
+// 0.0 and -0.0 compare equal, so they must hash the same
+template <>
+struct hash<float> {
+  typedef float argument_type;
+  typedef std::size_t result_type;
+
+  std::size_t operator()(float value) const {
+    return value == 0 ? 0 : hash_bytes(&value, sizeof(value));
+  }
+};
+
+template <>
+struct hash<double> {
+  typedef double argument_type;
+  typedef std::size_t result_type;
+
+  std::size_t operator()(double value) const {
+    return value == 0 ? 0 : hash_bytes(&value, sizeof(value));
+  }
+};
+
 }  // namespace ft
 
 #endif  // UTILITIES_H
\ No newline at end of file
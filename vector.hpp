@@ -1,17 +1,20 @@
 #ifndef VECTOR_H
 #define VECTOR_H
+#include "growth_policy.hpp"
 #include "iterator_vector.hpp"
 #include "utilities.hpp"
 
 namespace ft {
 
-template <typename T, typename Allocator = std::allocator<T> >
+template <typename T, typename Allocator = std::allocator<T>,
+          typename GrowthPolicy = ft::growth_double>
 class vector {
  public:
   typedef T value_type;
   typedef std::size_t size_type;
   typedef std::ptrdiff_t difference_type;
   typedef Allocator allocator_type;
+  typedef GrowthPolicy growth_policy;
 
   typedef typename Allocator::pointer pointer;
   typedef typename Allocator::const_pointer const_pointer;
@@ -22,6 +25,32 @@ class vector {
   typedef ft::reverse_iterator<iterator> reverse_iterator;
   typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
 
+ private:
+  // Whether objects are moved with memcpy/memmove when the vector grows or
+  // shifts its elements. That skips allocator_.construct/destroy, so apart
+  // from integral types (which never go through the allocator, see
+  // construct()) it is only done with allocators like std::allocator
+  typedef ft::integral_constant<
+      bool, ft::is_integral<value_type>::value ||
+                (ft::is_trivially_relocatable<value_type>::value &&
+                 ft::has_default_construct<Allocator>::value)>
+      relocatable;
+
+  // Whether new objects may be left uninitialized by resize_default_init()
+  typedef ft::integral_constant<
+      bool, ft::is_integral<value_type>::value ||
+                (ft::is_trivially_default_constructible<value_type>::value &&
+                 ft::has_default_construct<Allocator>::value)>
+      default_initializable;
+
+  // Whether the buffer can grow without moving the objects by hand, see
+  // remap_buffer()
+  typedef ft::integral_constant<bool, relocatable::value &&
+                                          ft::has_reallocate<Allocator>::value>
+      remappable;
+
+ public:
+
   //**************************************************
   // Constructors
   //**************************************************
@@ -88,14 +117,28 @@ class vector {
     if (other.size()) assign(other.begin(), other.end());
   }
 
+#if __cplusplus >= 201103L
   /**
-   * @brief Destroy the vector object
+   * @brief Move constructor, takes over the objects of other
    *
+   * @param other vector to move from, empty afterwards
    */
-  ~vector() {
-    clear();
-    deallocate_all();
+  vector(vector&& other) noexcept
+      : allocator_(ft::move(other.allocator_)),
+        start_(other.start_),
+        finish_(other.finish_),
+        end_of_storage_(other.end_of_storage_) {
+    other.start_ = NULL;
+    other.finish_ = NULL;
+    other.end_of_storage_ = NULL;
   }
+#endif
+
+  /**
+   * @brief Destroy the vector object
+   *
+   */
+  ~vector() { release_buffer(); }
 
   //**************************************************
   // Operator overloads
@@ -112,6 +155,20 @@ class vector {
     return *this;
   }
 
+#if __cplusplus >= 201103L
+  /**
+   * @brief move assignment operator overload
+   *
+   * @param other source, empty afterwards
+   * @return vector& *this after assigning
+   */
+  vector& operator=(vector&& other) {
+    vector tmp(ft::move(other));
+    swap(tmp);
+    return *this;
+  }
+#endif
+
   //**************************************************
   // Member functions
   //**************************************************
@@ -124,7 +181,7 @@ class vector {
    */
   void assign(size_type count, const T& value) {
     if (this->capacity() < count) {
-      this->~vector();
+      release_buffer();
       start_ = allocate(count);
       finish_ = start_ + count;
       uninitialized_fill_n(start_, count, value);
@@ -217,23 +274,48 @@ class vector {
   void reserve(size_type new_cap) {
     if (new_cap > this->max_size())
       throw std::length_error("new_cap exceeded size in vector::reserve()");
-    size_type size = this->size();
-    if (new_cap > capacity()) {
-      pointer tmp = allocate(new_cap);
-      if (ft::is_integral<value_type>::value)
-        std::memcpy(tmp, start_, size * sizeof(value_type));
-      else
-        for (unsigned int i = 0; i < size; ++i)
-          construct(tmp + i, *(start_ + i));
-      this->~vector();
-      start_ = tmp;
-      finish_ = start_ + new_cap;
-      end_of_storage_ = start_ + size;
-    }
+    if (new_cap > capacity() && !remap_buffer(new_cap))
+      replace_buffer(allocate(new_cap), new_cap, size(), 0);
   }
 
   size_type capacity() const { return finish_ - start_; }
 
+  /**
+   * @brief reduces the capacity to the size. An empty vector gives its buffer
+   * back completely
+   *
+   */
+  void shrink_to_fit() {
+    size_type size = this->size();
+    if (capacity() == size) return;
+    if (size == 0)
+      deallocate_all();
+    else if (!remap_buffer(size))
+      replace_buffer(allocate(size), size, size, 0);
+  }
+
+  /**
+   * @brief shrink_to_fit, but only if more than the fraction max_slack of the
+   * capacity is unused. Cheap to call regularly, e.g. after erasing
+   *
+   * @param max_slack between 0 (always shrink) and 1 (never shrink)
+   * @return true if the buffer was reallocated
+   */
+  bool trim(double max_slack = 0.5) {
+    size_type slack = capacity() - size();
+    if (slack == 0 || slack <= max_slack * capacity()) return false;
+    shrink_to_fit();
+    return true;
+  }
+
+  /**
+   * @brief the number of bytes the buffer occupies on the heap, used or not.
+   * Memory owned by the objects themselves is not included
+   *
+   * @return size_type
+   */
+  size_type memory_usage() const { return capacity() * sizeof(value_type); }
+
   /**
    * @brief sets the size to 0 and destroys all stored objects
    *
@@ -303,12 +385,12 @@ class vector {
     size_type new_size = this->size() - 1;
     size_type n_objects_to_move = new_size - pos_first_removal;
 
-    if (ft::is_integral<value_type>::value) {
-      std::memmove(pos.base(), pos.base() + 1,
-                   n_objects_to_move * sizeof(value_type));
+    if (relocatable::value) {
+      destroy(pos.base(), pos.base() + 1);
+      relocate(pos.base(), pos.base() + 1, n_objects_to_move);
     } else {
       for (unsigned int i = pos_first_removal; i < new_size; ++i)
-        start_[i] = start_[i + 1];
+        start_[i] = ft::move(start_[i + 1]);
       allocator_.destroy(start_ + new_size);
     }
     --end_of_storage_;
@@ -329,12 +411,12 @@ class vector {
     size_type pos_first_removal = first - start_;
     size_type n_objects_to_move = new_size - pos_first_removal;
 
-    if (ft::is_integral<value_type>::value) {
-      std::memmove(first.base(), first.base() + distance,
-                   n_objects_to_move * sizeof(value_type));
+    if (relocatable::value) {
+      destroy(first.base(), last.base());
+      relocate(first.base(), last.base(), n_objects_to_move);
     } else {
       for (unsigned int i = pos_first_removal; i < new_size; ++i)
-        start_[i] = start_[i + distance];
+        start_[i] = ft::move(start_[i + distance]);
       destroy(start_ + new_size, end_of_storage_);
     }
 
@@ -348,12 +430,114 @@ class vector {
    * @param value
    */
   void push_back(const value_type& value) {
+    if (end_of_storage_ != finish_) {
+      construct(end_of_storage_, value);
+      ++end_of_storage_;
+      return;
+    }
     size_type size = this->size();
-    size_type capacity = this->capacity();
-    if (size == capacity) reserve(std::max((size_type)1, capacity * 2));
-    construct(start_ + size, value);
-    ++end_of_storage_;
+    size_type new_capacity = grown_capacity(size + 1);
+    const value_type* source = &value;
+    if (remap_buffer(new_capacity, source)) {
+      construct(end_of_storage_, *source);
+      ++end_of_storage_;
+      return;
+    }
+    // value may be one of our objects, so it is copied before they move
+    pointer tmp = allocate(new_capacity);
+    try {
+      construct(tmp + size, value);
+    } catch (...) {
+      allocator_.deallocate(tmp, new_capacity);
+      throw;
+    }
+    replace_buffer(tmp, new_capacity, size, 1);
+  }
+
+#if __cplusplus >= 201103L
+  /**
+   * @brief Moves an object "value" to the end of the vector
+   *
+   * @param value
+   */
+  void push_back(value_type&& value) {
+    value_type* source = &value;
+    if (end_of_storage_ == finish_ &&
+        remap_buffer(grown_capacity(size() + 1), source)) {
+      construct(end_of_storage_, ft::move(*source));
+      ++end_of_storage_;
+      return;
+    }
+    emplace_back(ft::move(value));
+  }
+
+  /**
+   * @brief Constructs an object from args at the end of the vector
+   *
+   * @tparam Args
+   * @param args arguments for the constructor of value_type
+   */
+  template <class... Args>
+  void emplace_back(Args&&... args) {
+    if (end_of_storage_ == finish_) {
+      emplace_with_realloc(size(), std::forward<Args>(args)...);
+    } else {
+      emplace_construct(end_of_storage_, std::forward<Args>(args)...);
+      ++end_of_storage_;
+    }
+  }
+
+  /**
+   * @brief Moves one element into the vector
+   *
+   * @param pos An Iterator pointing to the insert position
+   * @param value
+   * @return iterator An iterator to the position of the new insert
+   */
+  iterator insert(const const_iterator& pos, value_type&& value) {
+    return emplace(pos, ft::move(value));
+  }
+
+  /**
+   * @brief Constructs an object from args in front of pos
+   *
+   * @tparam Args
+   * @param pos An Iterator pointing to the insert position
+   * @param args arguments for the constructor of value_type
+   * @return iterator An iterator to the position of the new object
+   */
+  template <class... Args>
+  iterator emplace(const const_iterator& pos, Args&&... args) {
+    size_type insert_position = pos.base() - start_;
+    if (end_of_storage_ == finish_) {
+      emplace_with_realloc(insert_position, std::forward<Args>(args)...);
+    } else if (pos.base() == end_of_storage_) {
+      emplace_construct(end_of_storage_, std::forward<Args>(args)...);
+      ++end_of_storage_;
+    } else {
+      // args may refer to one of the objects that are shifted
+      value_type value(std::forward<Args>(args)...);
+      if (relocatable::value) {
+        pointer gap = open_gap(insert_position, 1);
+        try {
+          construct(gap, ft::move(value));
+        } catch (...) {
+          close_gap(insert_position, 1, 0);
+          throw;
+        }
+        ++end_of_storage_;
+      } else {
+        construct(end_of_storage_, ft::move(end_of_storage_[-1]));
+        ++end_of_storage_;
+        pointer dest = end_of_storage_ - 2;
+        for (; dest != start_ + insert_position; --dest)
+          *dest = ft::move(dest[-1]);
+        start_[insert_position] = ft::move(value);
+      }
+    }
+    return iterator(start_ + insert_position);
   }
+#endif
 
   /**
    * @brief Removes the last object of the vector
@@ -386,29 +570,73 @@ class vector {
     size_type size = this->size();
     if (size < count) {
       if (this->capacity() < count) {
-        pointer tmp = allocate(count);
-
-        if (ft::is_integral<value_type>::value)
-          std::memcpy(tmp, start_, size * sizeof(value_type));
-        else
-          for (unsigned int i = 0; i < size; ++i) construct(tmp + i, start_[i]);
-        for (unsigned int i = size; i < count; ++i) construct(tmp + i, value);
-
-        this->~vector();
-        start_ = tmp;
-        end_of_storage_ = start_ + count;
-        finish_ = end_of_storage_;
-      } else {
-        for (unsigned int i = size; i < count; ++i)
-          construct(start_ + i, value);
-        end_of_storage_ = start_ + count;
+        size_type new_capacity = grown_capacity(count);
+        if (!remap_buffer(new_capacity)) {
+          pointer tmp = allocate(new_capacity);
+          size_type i = size;
+          try {
+            for (; i < count; ++i) construct(tmp + i, value);
+          } catch (...) {
+            destroy(tmp + size, tmp + i);
+            allocator_.deallocate(tmp, new_capacity);
+            throw;
+          }
+          replace_buffer(tmp, new_capacity, size, count - size);
+          return;
+        }
       }
+      for (unsigned int i = size; i < count; ++i) construct(start_ + i, value);
+      end_of_storage_ = start_ + count;
     } else if (size > count) {
       destroy(start_ + count, end_of_storage_);
       end_of_storage_ = start_ + count;
     }
   }
 
+  /**
+   * @brief resize(), but new objects of trivial types like char or int are
+   * left uninitialized instead of being zeroed, which saves a pass over the
+   * memory of a buffer that is about to be overwritten anyway. Other types
+   * are value-initialized like with resize()
+   *
+   * @param count new size
+   */
+  void resize_default_init(size_type count) {
+    size_type size = this->size();
+    if (!default_initializable::value || count <= size) {
+      resize(count);
+      return;
+    }
+    if (count > max_size())
+      throw std::length_error("resize count exceeded max_size()");
+    if (this->capacity() < count) {
+      size_type new_capacity = grown_capacity(count);
+      if (!remap_buffer(new_capacity)) {
+        replace_buffer(allocate(new_capacity), new_capacity, size,
+                       count - size);
+        return;
+      }
+    }
+    end_of_storage_ = start_ + count;
+  }
+
+  /**
+   * @brief Appends n objects like resize_default_init() and returns where they
+   * start, so they can be written directly, e.g. by read(2):
+   *   ssize_t got = read(fd, buf.append_uninitialized(n), n);
+   *   buf.resize(buf.size() - n + (got > 0 ? got : 0));
+   *
+   * @param n
+   * @return pointer to the first new object
+   */
+  pointer append_uninitialized(size_type n) {
+    size_type size = this->size();
+    if (n > max_size() - size)
+      throw std::length_error("append_uninitialized exceeded max_size()");
+    resize_default_init(size + n);
+    return start_ + size;
+  }
+
   /**
    * @brief Swaps the allocator and all objects/size/capacity with another
    * vector
@@ -422,11 +650,14 @@ class vector {
     std::swap(this->end_of_storage_, other.end_of_storage_);
   }
 
- private:
+ protected:
   //**************************************************
-  // Private member objects
+  // Member objects
   //**************************************************
 
+  // Protected, so containers built on vector (small_vector) can manage the
+  // buffer themselves
+
   allocator_type allocator_;
   pointer start_;
   pointer finish_;
@@ -442,7 +673,7 @@ class vector {
     size_type distance = get_distance(first, last);
 
     if (this->capacity() < distance) {
-      this->~vector();
+      release_buffer();
       start_ = allocate(distance);
       // memcpy only for:
       // 1) random_access_iterators: contiguous memory
@@ -453,7 +684,8 @@ class vector {
                       std::random_access_iterator_tag>::value &&
           ft::is_integral<value_type>::value &&
           sizeof(*first) == sizeof(*start_))
-        std::memcpy(start_, &(*first), distance * sizeof(value_type));
+        std::memcpy(static_cast<void*>(start_), &(*first),
+                    distance * sizeof(value_type));
       else
         uninitialized_copy_n(first, distance, start_);
       end_of_storage_ = start_ + distance;
@@ -498,50 +730,55 @@ class vector {
       size_type new_size = size + count;
       size_type insert_position = pos.base() - start_;
       size_type n_objects_to_move = size - insert_position;
-      // First step: Copy from back to new_size
-      if (ft::is_integral<value_type>::value)
-        std::memmove(start_ + insert_position + count, start_ + insert_position,
-                     n_objects_to_move * sizeof(value_type));
-      else {
-        // Make space for new objects: move objects "count" spaces to "right"
-        size_type i = 0;  // number of objects constructed
-        size_type index_new_last_element = new_size - 1;
-        try {
-          // Costruct from behind
-          while (i < n_objects_to_move) {
-            if (new_size - 1 - i < size)
-              allocator_.destroy(start_ + new_size - 1 - i);
-            construct(start_ + new_size - 1 - i,
-                      start_[new_size - 1 - i - count]);
-            ++i;
-          }
-        } catch (...) {
-          // If exception is thrown, destroy all already constructed objects
-          destroy(start_ + index_new_last_element, end_of_storage_ + count);
-          throw "Exception when inserting new objects into vector";
-        }
-      }
-
-      // Second step: construct new objects
-      if (ft::is_integral<value_type>::value) {
-        for (unsigned int i = 0; i < count; ++i)
-          start_[insert_position + i] = value;
-      } else {
+      // value may be one of the objects that are shifted, it follows that
+      // object "count" places to the right
+      const value_type* source = &value;
+      if (source >= pos.base() && source < end_of_storage_) source += count;
+      if (relocatable::value) {
+        pointer gap = open_gap(insert_position, count);
         size_type i = 0;
         try {
           while (i < count) {
-            // construct(start_ + insert_position + i, value);
-            // allocator_.destroy(start_ + insert_position + + i)
-            start_[insert_position + i] = value;
+            construct(gap + i, *source);
             ++i;
           }
         } catch (...) {
-          // if an exception is thrown, just stop and leave old objects in the
-          // range
+          close_gap(insert_position, count, i);
           throw "Exception when inserting new objects into vector";
         }
+        end_of_storage_ += count;
+        return;
+      }
+      pointer position = start_ + insert_position;
+      pointer old_end = end_of_storage_;
+      pointer tail = position + count;
+      pointer built = old_end;    // [old_end;built) holds new objects
+      pointer built_tail = tail;  // and so does [tail;built_tail)
+      try {
+        if (n_objects_to_move > count) {
+          // The last count objects move into uninitialized memory, the others
+          // are assigned from the back
+          for (pointer src = old_end - count; src != old_end; ++src, ++built)
+            construct(built, ft::move(*src));
+          for (size_type i = n_objects_to_move - count; i > 0; --i)
+            tail[i - 1] = ft::move(position[i - 1]);
+          for (pointer dest = position; dest != tail; ++dest) *dest = *source;
+        } else {
+          // All shifted objects land behind the old end, and so do the copies
+          // of value that don't fit in front of it
+          for (pointer src = position; src != old_end; ++src, ++built_tail)
+            construct(built_tail, ft::move(*src));
+          for (; built != tail; ++built) construct(built, *source);
+          for (pointer dest = position; dest != old_end; ++dest)
+            *dest = *source;
+        }
+      } catch (...) {
+        // Basic guarantee: the size stays, objects built past it are destroyed
+        destroy(old_end, built);
+        destroy(tail, built_tail);
+        throw "Exception when inserting new objects into vector";
       }
-      end_of_storage_ += count;
+      end_of_storage_ = start_ + new_size;
     } else {
       // Strong guarantee
       size_type i = 0;
@@ -561,58 +798,23 @@ class vector {
 
   void _insert_with_realloc(const const_iterator& pos, size_type count,
                             const value_type& value) {
-    size_type size = this->size();
-    size_type new_size = size + count;
-    size_type new_capacity;
-    if (count == 1) {
-      new_capacity = std::max((size_type)1, capacity() * 2);
-      while (new_capacity < new_size) new_capacity *= 2;
-    } else {
-      new_capacity = new_size;
-    }
-    if (new_capacity > max_size())
-      throw std::length_error("new capacity over max_size");
+    size_type new_capacity = grown_capacity(size() + count);
     pointer tmp = allocate(new_capacity);
     size_type insert_position = pos.base() - start_;
-    size_type n_objects_to_move = size - insert_position;
-    size_type i = 0;  // Counts the number of objects in tmp
-    // Strong guarantee
+    size_type i = 0;  // Counts the new objects in tmp
+    // The new objects are built first: value may be one of the old objects,
+    // and if building one throws the old objects are still untouched
     try {
-      // Copy part before insert to tmp
-      if (ft::is_integral<value_type>::value) {
-        std::memcpy(tmp, start_, insert_position * sizeof(value_type));
-        i += insert_position;
-      } else {
-        while (i < insert_position) {
-          construct(tmp + i, start_[i]);
-          ++i;
-        }
-      }
-      // Construct new objects
-      size_type pos_end_of_insert = insert_position + count;
-      while (i < pos_end_of_insert) {
-        construct(tmp + i, value);
+      while (i < count) {
+        construct(tmp + insert_position + i, value);
         ++i;
       }
-      // Copy part after insert to tmp
-      if (ft::is_integral<value_type>::value)
-        std::memcpy(tmp + i, start_ + insert_position,
-                    n_objects_to_move * sizeof(value_type));
-      else {
-        while (i < new_size) {
-          construct(tmp + i, start_[i - count]);
-          ++i;
-        }
-      }
     } catch (...) {
-      destroy(tmp, tmp + i + 1);
-      allocator_.deallocate(tmp, new_capacity * sizeof(value_type));
+      destroy(tmp + insert_position, tmp + insert_position + i);
+      allocator_.deallocate(tmp, new_capacity);
       throw "Exception when inserting new objects into vector";
     }
-    this->~vector();
-    start_ = tmp;
-    end_of_storage_ = start_ + new_size;
-    finish_ = start_ + new_capacity;
+    replace_buffer(tmp, new_capacity, insert_position, count);
   }
 
   template <class InputIt>
@@ -633,54 +835,57 @@ class vector {
                                 InputIt last) {
     size_type insert_position = pos.base() - start_;
     size_type distance = get_distance(first, last);
+    if (distance == 0) return;
     if (pos != end()) {
       // Basic guarantee
       size_type size = this->size();
       size_type new_size = size + distance;
       size_type n_objects_to_move = size - insert_position;
-      // First step: Copy from back to new_size
-      if (ft::is_integral<value_type>::value)
-        std::memmove(start_ + insert_position + distance,
-                     start_ + insert_position,
-                     n_objects_to_move * sizeof(value_type));
-      else {
-        // Make space for new objects: move objects "count" spaces to "right"
-        size_type i = 0;  // number of objects constructed
-        size_type index_new_last_element = new_size - 1;
-        try {
-          // Costruct from behind
-          while (i < n_objects_to_move) {
-            if (new_size - 1 - i < size)
-              allocator_.destroy(start_ + new_size - 1 - i);
-            construct(start_ + new_size - 1 - i,
-                      start_[new_size - 1 - i - distance]);
-            ++i;
-          }
-        } catch (...) {
-          // If exception is thrown, destroy all already constructed objects
-          destroy(start_ + index_new_last_element, end_of_storage_ + distance);
-          throw "Exception when inserting new objects into vector";
-        }
-      }
-
-      // Second step: construct new objects
-      if (ft::is_integral<value_type>::value) {
-        for (size_type i = 0; i < distance; ++i)
-          start_[insert_position + i] = *(first++);
-      } else {
+      if (relocatable::value) {
+        pointer gap = open_gap(insert_position, distance);
         size_type i = 0;
         try {
           while (i < distance) {
-            start_[insert_position + i] = *(first++);
+            construct(gap + i, *(first++));
             ++i;
           }
         } catch (...) {
-          // if an exception is thrown, just stop and leave old objects in the
-          // range
+          close_gap(insert_position, distance, i);
           throw "Exception when inserting new objects into vector";
         }
+        end_of_storage_ += distance;
+        return;
       }
-      end_of_storage_ += distance;
+      // Same as _insert_no_realloc
+      pointer position = start_ + insert_position;
+      pointer old_end = end_of_storage_;
+      pointer tail = position + distance;
+      pointer built = old_end;    // [old_end;built) holds new objects
+      pointer built_tail = tail;  // and so does [tail;built_tail)
+      try {
+        if (n_objects_to_move > distance) {
+          pointer src = old_end - distance;
+          for (; src != old_end; ++src, ++built)
+            construct(built, ft::move(*src));
+          for (size_type i = n_objects_to_move - distance; i > 0; --i)
+            tail[i - 1] = ft::move(position[i - 1]);
+          for (pointer dest = position; dest != tail; ++dest)
+            *dest = *(first++);
+        } else {
+          InputIt mid = first;
+          for (size_type i = 0; i < n_objects_to_move; ++i) ++mid;
+          for (pointer src = position; src != old_end; ++src, ++built_tail)
+            construct(built_tail, ft::move(*src));
+          for (; built != tail; ++built) construct(built, *(mid++));
+          for (pointer dest = position; dest != old_end; ++dest)
+            *dest = *(first++);
+        }
+      } catch (...) {
+        destroy(old_end, built);
+        destroy(tail, built_tail);
+        throw "Exception when inserting new objects into vector";
+      }
+      end_of_storage_ = start_ + new_size;
     } else {
       // Strong guarantee
       size_type i = 0;
@@ -701,78 +906,44 @@ class vector {
   template <class InputIt>
   void _insert_range_with_realloc(const const_iterator& pos, InputIt first,
                                   InputIt last) {
-    size_type size = this->size();
     size_type distance = get_distance(first, last);
-    size_type new_size = size + distance;
-    size_type new_capacity = std::max((size_type)1, capacity());
-
-    while (new_capacity < new_size) new_capacity *= 2;
-    if (new_capacity > max_size())
-      throw std::length_error("new capacity over max_size");
+    size_type new_capacity = grown_capacity(size() + distance);
     pointer tmp = allocate(new_capacity);
     size_type insert_position = pos.base() - start_;
-    size_type n_objects_to_move = size - insert_position;
-    size_type i = 0;  // Counts the number of objects in tmp
-    // Strong guarantee
+    size_type i = 0;  // Counts the new objects in tmp
     try {
-      // Copy part before insert to tmp
-      if (ft::is_integral<value_type>::value) {
-        std::memcpy(tmp, start_, insert_position * sizeof(value_type));
-        i += insert_position;
-      } else {
-        while (i < insert_position) {
-          construct(tmp + i, start_[i]);
-          ++i;
-        }
-      }
-      // Construct new objects
-      size_type pos_end_of_insert = insert_position + distance;
-      while (i < pos_end_of_insert) {
-        construct(tmp + i, *(first++));
+      while (i < distance) {
+        construct(tmp + insert_position + i, *(first++));
         ++i;
       }
-
-      // Copy part after insert to tmp
-      if (ft::is_integral<value_type>::value)
-        std::memcpy(tmp + i, start_ + insert_position,
-                    n_objects_to_move * sizeof(value_type));
-      else {
-        while (i < new_size) {
-          construct(tmp + i, start_[i - distance]);
-          ++i;
-        }
-      }
     } catch (...) {
-      allocator_.deallocate(tmp, new_capacity * sizeof(value_type));
+      destroy(tmp + insert_position, tmp + insert_position + i);
+      allocator_.deallocate(tmp, new_capacity);
       throw "Exception when inserting new objects into vector";
     }
-    this->~vector();
-    start_ = tmp;
-    end_of_storage_ = start_ + new_size;
-    finish_ = start_ + new_capacity;
+    replace_buffer(tmp, new_capacity, insert_position, distance);
   }
 
+  // The range can only be read once, so it is appended behind the objects and
+  // then rotated into place. If reading or building an object throws, the
+  // appended objects are removed again
   template <class InputIt>
   void _insert_helper(const const_iterator& pos, InputIt first, InputIt last,
                       std::input_iterator_tag) {
     size_type size = this->size();
     size_type insert_position = pos.base() - start_;
-    vector<value_type> tmp;
-    tmp.reserve(size);
-    size_type i = 0;  // built elements
-    size_type distance_range = 0;
     try {
-      while (i < insert_position) tmp.push_back(start_[i++]);
       while (first != last) {
-        tmp.push_back(*first);
+        push_back(*first);
         ++first;
-        distance_range++;
       }
-      while (i < size) tmp.push_back(start_[i++]);
     } catch (...) {
+      destroy(start_ + size, end_of_storage_);
+      end_of_storage_ = start_ + size;
       throw "Exception when inserting new objects into vector";
     }
-    assign(tmp.begin(), tmp.end());
+    if (insert_position != size)
+      std::rotate(start_ + insert_position, start_ + size, end_of_storage_);
   }
 
   // Constructs a range from first until first + n into the uninitialized
@@ -822,10 +993,173 @@ class vector {
     return distance;
   }
 
+  /**
+   * @brief Moves n objects from src to dest by copying their bytes. Only for
+   * trivially relocatable types: the objects live at dest afterwards and must
+   * not be destroyed at src. The ranges may overlap
+   *
+   * @param dest uninitialized storage for n objects
+   * @param src
+   * @param n
+   */
+  void relocate(pointer dest, pointer src, size_type n) {
+    if (n)
+      std::memmove(static_cast<void*>(dest), static_cast<void*>(src),
+                   n * sizeof(value_type));
+  }
+
+  /**
+   * @brief Relocates the objects from insert_position to the end count places
+   * to the right. The capacity must be large enough. The size is not changed
+   *
+   * @param insert_position
+   * @param count
+   * @return pointer the start of the gap, which holds no objects
+   */
+  pointer open_gap(size_type insert_position, size_type count) {
+    pointer gap = start_ + insert_position;
+    relocate(gap + count, gap, end_of_storage_ - gap);
+    return gap;
+  }
+
+  /**
+   * @brief Undoes open_gap after constructing into the gap failed
+   *
+   * @param insert_position
+   * @param count
+   * @param constructed number of objects already constructed in the gap
+   */
+  void close_gap(size_type insert_position, size_type count,
+                 size_type constructed) {
+    pointer gap = start_ + insert_position;
+    destroy(gap, gap + constructed);
+    relocate(gap, gap + count, end_of_storage_ - gap);
+  }
+
+  /**
+   * @brief Moves the objects over to the new buffer tmp and frees the old one.
+   * The count new objects at insert_position in tmp are already built, the
+   * old objects are placed around them. Objects whose move constructor may
+   * throw are copied, so the vector stays untouched if that throws
+   *
+   * @param tmp buffer for new_capacity objects
+   * @param new_capacity
+   * @param insert_position
+   * @param count
+   */
+  void replace_buffer(pointer tmp, size_type new_capacity,
+                      size_type insert_position, size_type count) {
+    size_type size = this->size();
+    size_type n_objects_to_move = size - insert_position;
+    pointer tmp_tail = tmp + insert_position + count;
+    if (relocatable::value) {
+      relocate(tmp, start_, insert_position);
+      relocate(tmp_tail, start_ + insert_position, n_objects_to_move);
+      deallocate_all();
+    } else {
+      size_type i = 0;  // objects built in front of the new ones
+      size_type j = 0;  // and behind them
+      try {
+        for (; i < insert_position; ++i)
+          construct(tmp + i, ft::move_if_noexcept(start_[i]));
+        for (; j < n_objects_to_move; ++j)
+          construct(tmp_tail + j,
+                    ft::move_if_noexcept(start_[insert_position + j]));
+      } catch (...) {
+        destroy(tmp, tmp + i);
+        destroy(tmp + insert_position, tmp_tail + j);
+        allocator_.deallocate(tmp, new_capacity);
+        throw;
+      }
+      release_buffer();
+    }
+    start_ = tmp;
+    end_of_storage_ = start_ + size + count;
+    finish_ = start_ + new_capacity;
+  }
+
+  /**
+   * @brief Resizes the buffer to new_capacity through the allocator's
+   * reallocate(), which moves the pages instead of the objects (see
+   * ft::mmap_allocator). Only for relocatable objects, they keep their indices
+   *
+   * @param new_capacity at least size()
+   * @return true if the buffer was resized, false if the allocator can't
+   */
+  bool remap_buffer(size_type new_capacity) {
+    return remap_buffer(new_capacity, remappable());
+  }
+
+  /**
+   * @brief remap_buffer, where object may point to one of the objects. It
+   * then points to where that object lives afterwards
+   */
+  template <class U>
+  bool remap_buffer(size_type new_capacity, U*& object) {
+    if (!remappable::value) return false;
+    bool own = object >= start_ && object < end_of_storage_;
+    size_type index = own ? object - start_ : 0;
+    if (!remap_buffer(new_capacity)) return false;
+    if (own) object = start_ + index;
+    return true;
+  }
+
+  bool remap_buffer(size_type, ft::false_type) { return false; }
+
+  bool remap_buffer(size_type new_capacity, ft::true_type) {
+    if (!start_) return false;
+    size_type size = this->size();
+    pointer tmp = allocator_.reallocate(start_, capacity(), new_capacity);
+    if (!tmp) return false;
+    start_ = tmp;
+    end_of_storage_ = start_ + size;
+    finish_ = start_ + new_capacity;
+    return true;
+  }
+
+#if __cplusplus >= 201103L
+  /**
+   * @brief Grows the buffer and constructs an object from args at
+   * insert_position. args may refer to an old object, so it is built first
+   *
+   * @tparam Args
+   * @param insert_position
+   * @param args
+   */
+  template <class... Args>
+  void emplace_with_realloc(size_type insert_position, Args&&... args) {
+    size_type new_capacity = grown_capacity(size() + 1);
+    pointer tmp = allocate(new_capacity);
+    try {
+      emplace_construct(tmp + insert_position, std::forward<Args>(args)...);
+    } catch (...) {
+      allocator_.deallocate(tmp, new_capacity);
+      throw;
+    }
+    replace_buffer(tmp, new_capacity, insert_position, 1);
+  }
+#endif
+
   //**************************************************
   // Allocation helpers
   //**************************************************
 
+  /**
+   * @brief The capacity to reallocate to when "required" objects don't fit,
+   * as chosen by the growth policy
+   *
+   * @param required
+   * @return size_type at least required, at most max_size()
+   */
+  size_type grown_capacity(size_type required) const {
+    if (required > max_size())
+      throw std::length_error("new capacity over max_size");
+    size_type new_capacity = GrowthPolicy::next_capacity(
+        capacity(), required, sizeof(value_type));
+    if (new_capacity < required) return required;
+    return std::min(new_capacity, max_size());
+  }
+
   pointer allocate(size_t n) {
     if (n > max_size()) throw std::bad_alloc();
     return static_cast<pointer>(allocator_.allocate(n));
@@ -840,6 +1174,13 @@ class vector {
     }
   }
 
+  // Destroys the objects and frees the buffer, but unlike ~vector() leaves
+  // allocator_ alive, so the vector can allocate a new buffer right away
+  void release_buffer() {
+    clear();
+    deallocate_all();
+  }
+
   template <class U>  // U = value_type
   void construct(
       U* position,
@@ -854,6 +1195,28 @@ class vector {
     allocator_.construct(position, value);
   }
 
+#if __cplusplus >= 201103L
+  template <class U>  // U = value_type
+  void construct(U* position,
+                 typename ft::enable_if<!ft::is_integral<U>::value, U>::type&&
+                     value) {
+    std::allocator_traits<allocator_type>::construct(allocator_, position,
+                                                     ft::move(value));
+  }
+
+  // Constructs from any arguments. Integral types skip the allocator like in
+  // construct()
+  template <class... Args>
+  void emplace_construct(pointer position, Args&&... args) {
+    if (ft::is_integral<value_type>::value)
+      ::new (static_cast<void*>(position))
+          value_type(std::forward<Args>(args)...);
+    else
+      std::allocator_traits<allocator_type>::construct(
+          allocator_, position, std::forward<Args>(args)...);
+  }
+#endif
+
   /**
    * @brief Destroys the objects in the range [first;last)
    *
@@ -873,50 +1236,63 @@ class vector {
 // Non-member operator overloads
 //**************************************************
 
-template <class T, class Alloc>
-bool operator==(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <class T, class Alloc, class Growth>
+bool operator==(const vector<T, Alloc, Growth>& lhs,
+                const vector<T, Alloc, Growth>& rhs) {
   if (lhs.size() != rhs.size()) return false;
   return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
-template <class T, class Alloc>
-bool operator!=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <class T, class Alloc, class Growth>
+bool operator!=(const vector<T, Alloc, Growth>& lhs,
+                const vector<T, Alloc, Growth>& rhs) {
   return !(lhs == rhs);
 }
 
-template <class T, class Alloc>
-bool operator<(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <class T, class Alloc, class Growth>
+bool operator<(const vector<T, Alloc, Growth>& lhs,
+               const vector<T, Alloc, Growth>& rhs) {
   return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
                                      rhs.end());
 }
 
-template <class T, class Alloc>
-bool operator>(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <class T, class Alloc, class Growth>
+bool operator>(const vector<T, Alloc, Growth>& lhs,
+               const vector<T, Alloc, Growth>& rhs) {
   return !(lhs < rhs || lhs == rhs);
 }
 
-template <class T, class Alloc>
-bool operator<=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <class T, class Alloc, class Growth>
+bool operator<=(const vector<T, Alloc, Growth>& lhs,
+                const vector<T, Alloc, Growth>& rhs) {
   return !(lhs > rhs);
 }
 
-template <class T, class Alloc>
-bool operator>=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <class T, class Alloc, class Growth>
+bool operator>=(const vector<T, Alloc, Growth>& lhs,
+                const vector<T, Alloc, Growth>& rhs) {
   return !(lhs < rhs);
 }
 
+// A vector only holds pointers to its buffer, never into itself
+template <class T, class Growth>
+struct is_trivially_relocatable<vector<T, std::allocator<T>, Growth> >
+    : public true_type {};
+
 // Uncomment this to pass the ft-containers-terminator tester even though we are
 // not supposed to implement an ft:swap function
-/* template <class T, class Alloc>
-void swap(ft::vector<T, Alloc>& lhs, ft::vector<T, Alloc>& rhs) {
+/* template <class T, class Alloc, class Growth>
+void swap(ft::vector<T, Alloc, Growth>& lhs,
+          ft::vector<T, Alloc, Growth>& rhs) {
   lhs.swap(rhs);
 } */
 
 }  // namespace ft
 // std::swap specialization for ft::vector
 namespace std {
-template <class T, class Alloc>
-void swap(ft::vector<T, Alloc>& lhs, ft::vector<T, Alloc>& rhs) {
+template <class T, class Alloc, class Growth>
+void swap(ft::vector<T, Alloc, Growth>& lhs,
+          ft::vector<T, Alloc, Growth>& rhs) {
   lhs.swap(rhs);
 }
 }  // namespace std